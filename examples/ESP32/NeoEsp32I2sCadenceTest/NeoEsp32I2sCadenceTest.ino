@@ -0,0 +1,195 @@
+//----------------------------------------------------------------------
+// NeoEsp32I2sCadenceTest
+// This will check the nibble table encoding of NeoEsp32I2sCadence3Step
+// against a simple bit by bit encoding, for many data sizes and values,
+// including the cleared sample that follows the data and that nothing
+// is written past it.  Then both are timed encoding 1k, 4k and 16k of 
+// data so the speed up on this chip is shown.
+//
+// No led strip needs to be connected, the results are on the Serial monitor
+//----------------------------------------------------------------------
+
+#include <NeoPixelBus.h>
+
+#if defined(ARDUINO_ARCH_ESP32) && !defined(CONFIG_IDF_TARGET_ESP32C3) && !defined(CONFIG_IDF_TARGET_ESP32S3)
+
+typedef NeoEsp32I2sCadence3Step Cadence;
+
+const size_t MaxDataSize = 16384;
+const uint8_t Sentinel = 0xa5;
+
+uint8_t* data;
+uint8_t* dma;
+uint8_t* expected;
+uint16_t failures = 0;
+
+void Check(bool passed, const char* description)
+{
+    Serial.print(passed ? "PASS " : "FAIL ");
+    Serial.println(description);
+    if (!passed)
+    {
+        failures++;
+    }
+}
+
+// each bit is a 3 bit symbol, 0 = 100, 1 = 110, written most significant
+// bit first into the 16 bit samples, the last sample padded with zero
+void ReferenceEncode(uint8_t* dmaBuffer, const uint8_t* data, size_t sizeData)
+{
+    uint16_t* pDma = reinterpret_cast<uint16_t*>(dmaBuffer);
+    size_t bitDma = 0;
+
+    memset(dmaBuffer, 0x00, Cadence::EncodedDmaSize(sizeData));
+
+    for (size_t index = 0; index < sizeData; index++)
+    {
+        for (uint8_t bitSrc = 0; bitSrc < 8; bitSrc++)
+        {
+            uint8_t symbol = (data[index] & (0x80 >> bitSrc)) ? 0b110 : 0b100;
+
+            for (uint8_t bitSymbol = 0; bitSymbol < 3; bitSymbol++)
+            {
+                if (symbol & (0b100 >> bitSymbol))
+                {
+                    pDma[bitDma / 16] |= 0x8000 >> (bitDma % 16);
+                }
+                bitDma++;
+            }
+        }
+    }
+}
+
+bool CheckSize(size_t sizeData)
+{
+    const size_t sizeDma = Cadence::EncodedDmaSize(sizeData);
+    const size_t sizeWritten = sizeDma + Cadence::DmaOverrun;
+    bool passed = true;
+
+    for (size_t index = 0; index < sizeData; index++)
+    {
+        data[index] = random(256);
+    }
+    memset(dma, Sentinel, sizeWritten + 8);
+
+    Cadence::EncodeIntoDma(dma, data, sizeData);
+    ReferenceEncode(expected, data, sizeData);
+
+    passed = passed && (memcmp(dma, expected, sizeDma) == 0);
+
+    // an even size fills whole samples, so the following sample is cleared
+    // where an odd size ends within its last sample
+    if ((sizeData % 2) == 0)
+    {
+        passed = passed && (dma[sizeDma] == 0) && (dma[sizeDma + 1] == 0);
+    }
+    for (size_t index = sizeWritten; index < sizeWritten + 8; index++)
+    {
+        passed = passed && (dma[index] == Sentinel);
+    }
+
+    if (!passed)
+    {
+        Serial.print("  mismatch for data size ");
+        Serial.println(sizeData);
+    }
+    return passed;
+}
+
+void CheckEncoding()
+{
+    bool passed = true;
+
+    for (size_t sizeData = 0; sizeData <= 64; sizeData++)
+    {
+        passed = CheckSize(sizeData) && passed;
+    }
+    passed = CheckSize(1023) && passed;
+    passed = CheckSize(MaxDataSize) && passed;
+    
+    // every byte value in both the first and second of a pair
+    for (uint16_t value = 0; value < 256; value++)
+    {
+        data[0] = value;
+        data[1] = 255 - value;
+        data[2] = value;
+        Cadence::EncodeIntoDma(dma, data, 3);
+        ReferenceEncode(expected, data, 3);
+        passed = passed && (memcmp(dma, expected, Cadence::EncodedDmaSize(3)) == 0);
+    }
+
+    Check(passed, "nibble table matches bit by bit encoding");
+}
+
+void Benchmark(size_t sizeData)
+{
+    uint32_t start;
+    uint32_t timeTable;
+    uint32_t timeReference;
+
+    start = micros();
+    Cadence::EncodeIntoDma(dma, data, sizeData);
+    timeTable = micros() - start;
+
+    start = micros();
+    ReferenceEncode(expected, data, sizeData);
+    timeReference = micros() - start;
+
+    Serial.print("  ");
+    Serial.print(sizeData);
+    Serial.print(" bytes, nibble table ");
+    Serial.print(timeTable);
+    Serial.print("us, bit by bit ");
+    Serial.print(timeReference);
+    Serial.println("us");
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial); // wait for serial attach
+
+    Serial.println();
+    Serial.println("Running...");
+
+    const size_t sizeDmaMax = Cadence::EncodedDmaSize(MaxDataSize) + Cadence::DmaOverrun + 8;
+
+    data = static_cast<uint8_t*>(malloc(MaxDataSize));
+    dma = static_cast<uint8_t*>(malloc(sizeDmaMax));
+    expected = static_cast<uint8_t*>(malloc(sizeDmaMax));
+
+    if (data == nullptr || dma == nullptr || expected == nullptr)
+    {
+        Serial.println("not enough memory");
+        return;
+    }
+
+    CheckEncoding();
+
+    Serial.println();
+    Serial.print(failures);
+    Serial.println(" failures");
+
+    Serial.println();
+    Serial.println("Benchmark...");
+    Benchmark(1024);
+    Benchmark(4096);
+    Benchmark(16384);
+}
+
+#else
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial); // wait for serial attach
+
+    Serial.println();
+    Serial.println("NeoEsp32I2sCadence3Step is not available on this platform");
+}
+
+#endif
+
+void loop()
+{
+}
@@ -0,0 +1,262 @@
+//----------------------------------------------------------------------
+// NeoEsp32RmtTranslateTest
+// This will check the rmt item translation of every NeoEsp32RmtSpeed
+// and NeoEsp32RmtInvertedSpeed against a simple bit by bit translation.
+// The data is translated in chunks as the rmt driver does, for many data
+// sizes and wanted item counts, and the whole item streams, the chunk 
+// sizes and the reset extension of the last item are compared.  Then 
+// both are timed translating 900 bytes (300 Rgb pixels) so the speed up 
+// on this chip is shown.
+//
+// No led strip needs to be connected, the results are on the Serial monitor
+//----------------------------------------------------------------------
+
+#include <NeoPixelBus.h>
+
+#if defined(ARDUINO_ARCH_ESP32) && !defined(CONFIG_IDF_TARGET_ESP32C6) && !defined(CONFIG_IDF_TARGET_ESP32H2)
+
+const size_t MaxDataSize = 900;
+const size_t MaxItems = MaxDataSize * 8;
+const size_t MaxChunks = MaxDataSize + 1;
+
+// a chunk translated, as the rmt driver would be told
+struct Chunk
+{
+    size_t translatedSize;
+    size_t itemNum;
+};
+
+uint8_t data[MaxDataSize];
+rmt_item32_t* items;
+rmt_item32_t* expectedItems;
+Chunk chunks[MaxChunks];
+Chunk expectedChunks[MaxChunks];
+uint16_t failures = 0;
+
+void Check(bool passed, const char* description)
+{
+    Serial.print(passed ? "PASS " : "FAIL ");
+    Serial.println(description);
+    if (!passed)
+    {
+        failures++;
+    }
+}
+
+// one item per source bit, most significant bit first, the chunk ending
+// once wanted_num items are written or the source ends, where the last
+// item is extended to the reset duration
+template <typename T_SPEED> void ReferenceTranslate(const void* src,
+    rmt_item32_t* dest,
+    size_t src_size,
+    size_t wanted_num,
+    size_t* translated_size,
+    size_t* item_num)
+{
+    const uint8_t* psrc = static_cast<const uint8_t*>(src);
+    size_t size = 0;
+    size_t num = 0;
+
+    for (;;)
+    {
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            dest[num++].val = (psrc[size] & (0x80 >> bit)) ? T_SPEED::RmtBit1 : T_SPEED::RmtBit0;
+        }
+        size++;
+
+        if (size >= src_size)
+        {
+            dest[num - 1].duration1 = T_SPEED::RmtDurationReset;
+            break;
+        }
+        if (num >= wanted_num)
+        {
+            break;
+        }
+    }
+
+    *translated_size = size;
+    *item_num = num;
+}
+
+typedef void (*TranslateFn)(const void* src,
+    rmt_item32_t* dest,
+    size_t src_size,
+    size_t wanted_num,
+    size_t* translated_size,
+    size_t* item_num);
+
+// translates the whole of the data in chunks as the rmt driver does,
+// returning the number of chunks
+size_t TranslateStream(TranslateFn translate, 
+    rmt_item32_t* dest, 
+    Chunk* chunk, 
+    size_t sizeData, 
+    size_t wantedNum)
+{
+    size_t translated = 0;
+    size_t num = 0;
+    size_t count = 0;
+
+    while (translated < sizeData && count < MaxChunks)
+    {
+        translate(data + translated, 
+            dest + num, 
+            sizeData - translated, 
+            wantedNum, 
+            &chunk[count].translatedSize, 
+            &chunk[count].itemNum);
+
+        translated += chunk[count].translatedSize;
+        num += chunk[count].itemNum;
+        count++;
+    }
+    return count;
+}
+
+template <typename T_SPEED> bool CheckStream(size_t sizeData, size_t wantedNum)
+{
+    const size_t items32Size = sizeData * 8 * sizeof(rmt_item32_t);
+
+    memset(items, 0xa5, items32Size);
+    memset(expectedItems, 0x5a, items32Size);
+
+    size_t count = TranslateStream(T_SPEED::Translate, items, chunks, sizeData, wantedNum);
+    size_t expectedCount = TranslateStream(ReferenceTranslate<T_SPEED>, expectedItems, expectedChunks, sizeData, wantedNum);
+
+    bool passed = (count == expectedCount) &&
+        (memcmp(chunks, expectedChunks, count * sizeof(Chunk)) == 0) &&
+        (memcmp(items, expectedItems, items32Size) == 0);
+
+    if (!passed)
+    {
+        Serial.print("  mismatch for data size ");
+        Serial.print(sizeData);
+        Serial.print(" wanted ");
+        Serial.println(wantedNum);
+    }
+    return passed;
+}
+
+template <typename T_SPEED> void CheckSpeed(const char* name)
+{
+    const size_t wanted[] = { 0, 1, 7, 8, 9, 31, 32, 33, 64, 100, 256, MaxItems };
+    bool passed = true;
+
+    for (size_t index = 0; index < sizeof(wanted) / sizeof(wanted[0]); index++)
+    {
+        for (size_t sizeData = 1; sizeData <= 40; sizeData++)
+        {
+            passed = CheckStream<T_SPEED>(sizeData, wanted[index]) && passed;
+        }
+        passed = CheckStream<T_SPEED>(MaxDataSize, wanted[index]) && passed;
+    }
+
+    Check(passed, name);
+}
+
+template <typename T_SPEED> void Benchmark(size_t wantedNum)
+{
+    uint32_t start;
+    uint32_t timeTable;
+    uint32_t timeReference;
+
+    start = micros();
+    TranslateStream(T_SPEED::Translate, items, chunks, MaxDataSize, wantedNum);
+    timeTable = micros() - start;
+
+    start = micros();
+    TranslateStream(ReferenceTranslate<T_SPEED>, expectedItems, expectedChunks, MaxDataSize, wantedNum);
+    timeReference = micros() - start;
+
+    Serial.print("  ");
+    Serial.print(MaxDataSize);
+    Serial.print(" bytes in chunks of ");
+    Serial.print(wantedNum);
+    Serial.print(" items, bit pair table ");
+    Serial.print(timeTable);
+    Serial.print("us, bit by bit ");
+    Serial.print(timeReference);
+    Serial.println("us");
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial); // wait for serial attach
+
+    Serial.println();
+    Serial.println("Running...");
+
+    items = static_cast<rmt_item32_t*>(malloc(MaxItems * sizeof(rmt_item32_t)));
+    expectedItems = static_cast<rmt_item32_t*>(malloc(MaxItems * sizeof(rmt_item32_t)));
+
+    if (items == nullptr || expectedItems == nullptr)
+    {
+        Serial.println("not enough memory");
+        return;
+    }
+
+    for (size_t index = 0; index < MaxDataSize; index++)
+    {
+        data[index] = random(256);
+    }
+    // every byte value as well
+    for (uint16_t value = 0; value < 256; value++)
+    {
+        data[value] = value;
+    }
+
+    CheckSpeed<NeoEsp32RmtSpeedWs2811>("Ws2811");
+    CheckSpeed<NeoEsp32RmtSpeedWs2812x>("Ws2812x");
+    CheckSpeed<NeoEsp32RmtSpeedWs2805>("Ws2805");
+    CheckSpeed<NeoEsp32RmtSpeedSk6812>("Sk6812");
+    CheckSpeed<NeoEsp32RmtSpeedTm1814>("Tm1814");
+    CheckSpeed<NeoEsp32RmtSpeedTm1829>("Tm1829");
+    CheckSpeed<NeoEsp32RmtSpeedTm1914>("Tm1914");
+    CheckSpeed<NeoEsp32RmtSpeed800Kbps>("800Kbps");
+    CheckSpeed<NeoEsp32RmtSpeed400Kbps>("400Kbps");
+    CheckSpeed<NeoEsp32RmtSpeedApa106>("Apa106");
+    CheckSpeed<NeoEsp32RmtSpeedTx1812>("Tx1812");
+    CheckSpeed<NeoEsp32RmtSpeedGs1903>("Gs1903");
+
+    CheckSpeed<NeoEsp32RmtInvertedSpeedWs2811>("Ws2811 inverted");
+    CheckSpeed<NeoEsp32RmtInvertedSpeedWs2812x>("Ws2812x inverted");
+    CheckSpeed<NeoEsp32RmtInvertedSpeedWs2805>("Ws2805 inverted");
+    CheckSpeed<NeoEsp32RmtInvertedSpeedSk6812>("Sk6812 inverted");
+    CheckSpeed<NeoEsp32RmtInvertedSpeedTm1814>("Tm1814 inverted");
+    CheckSpeed<NeoEsp32RmtInvertedSpeedTm1829>("Tm1829 inverted");
+    CheckSpeed<NeoEsp32RmtInvertedSpeedTm1914>("Tm1914 inverted");
+    CheckSpeed<NeoEsp32RmtInvertedSpeed800Kbps>("800Kbps inverted");
+    CheckSpeed<NeoEsp32RmtInvertedSpeed400Kbps>("400Kbps inverted");
+    CheckSpeed<NeoEsp32RmtInvertedSpeedApa106>("Apa106 inverted");
+    CheckSpeed<NeoEsp32RmtInvertedSpeedTx1812>("Tx1812 inverted");
+    CheckSpeed<NeoEsp32RmtInvertedSpeedGs1903>("Gs1903 inverted");
+
+    Serial.println();
+    Serial.print(failures);
+    Serial.println(" failures");
+
+    Serial.println();
+    Serial.println("Benchmark...");
+    Benchmark<NeoEsp32RmtSpeedWs2812x>(64);
+    Benchmark<NeoEsp32RmtSpeedWs2812x>(MaxItems);
+}
+
+#else
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial); // wait for serial attach
+
+    Serial.println();
+    Serial.println("The rmt translation is not available on this platform");
+}
+
+#endif
+
+void loop()
+{
+}
@@ -0,0 +1,196 @@
+//----------------------------------------------------------------------
+// NeoEsp8266DmaEncodeTest
+// This will check the nibble table encoding of NeoEsp8266Dma3StepEncode
+// against a simple bit by bit encoding, for both the normal and inverted
+// patterns, many data sizes and every byte value, including the trailing
+// word and that nothing is written past it.  Then both are timed 
+// encoding 512 and 2k of data so the speed up on this chip is shown.
+//
+// No led strip needs to be connected, the results are on the Serial monitor
+//----------------------------------------------------------------------
+
+#include <NeoPixelBus.h>
+
+#if defined(ARDUINO_ARCH_ESP8266)
+
+const size_t MaxDataSize = 2048;
+const uint8_t Sentinel = 0xa5;
+
+uint8_t* data;
+uint8_t* dma;
+uint8_t* expected;
+uint16_t failures = 0;
+
+void Check(bool passed, const char* description)
+{
+    Serial.print(passed ? "PASS " : "FAIL ");
+    Serial.println(description);
+    if (!passed)
+    {
+        failures++;
+    }
+}
+
+// each bit is a 3 bit symbol of the pattern, written most significant 
+// bit first into the 32 bit words, the last word padded with zero,
+// and a zero word follows when the data fills whole words
+template <typename T_PATTERN> size_t ReferenceEncode(uint8_t* dmaBuffer, const uint8_t* data, size_t sizeData)
+{
+    uint32_t* pDma = reinterpret_cast<uint32_t*>(dmaBuffer);
+    size_t bitDma = 0;
+    size_t sizeWritten = (sizeData * 24 / 32 + 1) * sizeof(uint32_t);
+
+    memset(dmaBuffer, 0x00, sizeWritten);
+
+    for (size_t index = 0; index < sizeData; index++)
+    {
+        for (uint8_t bitSrc = 0; bitSrc < 8; bitSrc++)
+        {
+            uint8_t symbol = (data[index] & (0x80 >> bitSrc)) ? T_PATTERN::OneBit3Step : T_PATTERN::ZeroBit3Step;
+
+            for (uint8_t bitSymbol = 0; bitSymbol < 3; bitSymbol++)
+            {
+                if (symbol & (0b100 >> bitSymbol))
+                {
+                    pDma[bitDma / 32] |= 0x80000000 >> (bitDma % 32);
+                }
+                bitDma++;
+            }
+        }
+    }
+    return sizeWritten;
+}
+
+template <typename T_PATTERN> bool CheckSize(size_t sizeData)
+{
+    typedef NeoEsp8266Dma3StepEncode<T_PATTERN> Encode;
+
+    for (size_t index = 0; index < sizeData; index++)
+    {
+        data[index] = random(256);
+    }
+    memset(dma, Sentinel, Encode::EncodedDmaSize(sizeData) + Encode::DmaOverrun + 8);
+
+    Encode::EncodeIntoDma(dma, data, sizeData);
+    size_t sizeWritten = ReferenceEncode<T_PATTERN>(expected, data, sizeData);
+
+    bool passed = (sizeWritten <= Encode::EncodedDmaSize(sizeData) + Encode::DmaOverrun) &&
+        (memcmp(dma, expected, sizeWritten) == 0);
+
+    for (size_t index = sizeWritten; index < sizeWritten + 8; index++)
+    {
+        passed = passed && (dma[index] == Sentinel);
+    }
+
+    if (!passed)
+    {
+        Serial.print("  mismatch for data size ");
+        Serial.println(sizeData);
+    }
+    return passed;
+}
+
+template <typename T_PATTERN> void CheckPattern(const char* name)
+{
+    typedef NeoEsp8266Dma3StepEncode<T_PATTERN> Encode;
+    bool passed = true;
+
+    for (size_t sizeData = 0; sizeData <= 64; sizeData++)
+    {
+        passed = CheckSize<T_PATTERN>(sizeData) && passed;
+    }
+    passed = CheckSize<T_PATTERN>(1023) && passed;
+    passed = CheckSize<T_PATTERN>(MaxDataSize) && passed;
+
+    // every byte value in every position of a word group
+    for (uint16_t value = 0; value < 256; value++)
+    {
+        for (uint8_t index = 0; index < 5; index++)
+        {
+            data[index] = value + index * 51;
+        }
+        Encode::EncodeIntoDma(dma, data, 5);
+        size_t sizeWritten = ReferenceEncode<T_PATTERN>(expected, data, 5);
+        passed = passed && (memcmp(dma, expected, sizeWritten) == 0);
+    }
+
+    Check(passed, name);
+}
+
+template <typename T_PATTERN> void Benchmark(const char* name, size_t sizeData)
+{
+    typedef NeoEsp8266Dma3StepEncode<T_PATTERN> Encode;
+    uint32_t start;
+    uint32_t timeTable;
+    uint32_t timeReference;
+
+    start = micros();
+    Encode::EncodeIntoDma(dma, data, sizeData);
+    timeTable = micros() - start;
+
+    start = micros();
+    ReferenceEncode<T_PATTERN>(expected, data, sizeData);
+    timeReference = micros() - start;
+
+    Serial.print("  ");
+    Serial.print(name);
+    Serial.print(" ");
+    Serial.print(sizeData);
+    Serial.print(" bytes, nibble table ");
+    Serial.print(timeTable);
+    Serial.print("us, bit by bit ");
+    Serial.print(timeReference);
+    Serial.println("us");
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial); // wait for serial attach
+
+    Serial.println();
+    Serial.println("Running...");
+
+    const size_t sizeDmaMax = NeoEsp8266Dma3StepEncode<NeoEsp8266DmaNormalPattern>::EncodedDmaSize(MaxDataSize) + 
+        NeoEsp8266Dma3StepEncode<NeoEsp8266DmaNormalPattern>::DmaOverrun + 8;
+
+    data = static_cast<uint8_t*>(malloc(MaxDataSize));
+    dma = static_cast<uint8_t*>(malloc(sizeDmaMax));
+    expected = static_cast<uint8_t*>(malloc(sizeDmaMax));
+
+    if (data == nullptr || dma == nullptr || expected == nullptr)
+    {
+        Serial.println("not enough memory");
+        return;
+    }
+
+    CheckPattern<NeoEsp8266DmaNormalPattern>("normal pattern");
+    CheckPattern<NeoEsp8266DmaInvertedPattern>("inverted pattern");
+
+    Serial.println();
+    Serial.print(failures);
+    Serial.println(" failures");
+
+    Serial.println();
+    Serial.println("Benchmark...");
+    Benchmark<NeoEsp8266DmaNormalPattern>("normal", 512);
+    Benchmark<NeoEsp8266DmaNormalPattern>("normal", MaxDataSize);
+    Benchmark<NeoEsp8266DmaInvertedPattern>("inverted", MaxDataSize);
+}
+
+#else
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial); // wait for serial attach
+
+    Serial.println();
+    Serial.println("NeoEsp8266Dma3StepEncode is not available on this platform");
+}
+
+#endif
+
+void loop()
+{
+}
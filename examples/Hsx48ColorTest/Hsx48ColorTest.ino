@@ -0,0 +1,259 @@
+//----------------------------------------------------------------------
+// Hsx48ColorTest
+// This will check the integer Hsb48Color and Hsl48Color conversions
+// against the float HsbColor and HslColor conversions across a grid of 
+// hue, saturation and brightness/lightness, checking the largest
+// difference is within a few 16 bit steps, then time both so the speed
+// of the integer conversion on this platform is shown.
+//
+// No led strip needs to be connected, the results are on the Serial monitor
+//----------------------------------------------------------------------
+
+#include <NeoPixelBus.h>
+
+// largest difference allowed from the float conversions
+const uint16_t Rgb48Tolerance = 2; // of 65535
+const uint16_t RgbTolerance = 1; // of 255
+const uint16_t HueTolerance = 3; // of 65536
+const uint16_t ComponentTolerance = 2; // of 65535
+
+const uint16_t BenchmarkCount = 4096;
+
+uint16_t failures = 0;
+
+void Check(bool passed, const char* description)
+{
+    Serial.print(passed ? "PASS " : "FAIL ");
+    Serial.println(description);
+    if (!passed)
+    {
+        failures++;
+    }
+}
+
+uint16_t Difference(uint16_t a, uint16_t b)
+{
+    return (a > b) ? a - b : b - a;
+}
+
+// hue wraps, so the difference is the shorter way around the circle
+uint16_t HueDifference(uint16_t a, uint16_t b)
+{
+    uint16_t forward = a - b;
+    uint16_t backward = b - a;
+
+    return (forward < backward) ? forward : backward;
+}
+
+uint16_t LargestDifference(const Rgb48Color& a, const Rgb48Color& b)
+{
+    uint16_t largest = 0;
+
+    for (uint8_t index = 0; index < Rgb48Color::Count; index++)
+    {
+        uint16_t difference = Difference(a[index], b[index]);
+
+        if (difference > largest)
+        {
+            largest = difference;
+        }
+    }
+    return largest;
+}
+
+uint16_t LargestDifference(const RgbColor& a, const RgbColor& b)
+{
+    uint16_t largest = 0;
+
+    for (uint8_t index = 0; index < RgbColor::Count; index++)
+    {
+        uint16_t difference = Difference(a[index], b[index]);
+
+        if (difference > largest)
+        {
+            largest = difference;
+        }
+    }
+    return largest;
+}
+
+void PrintLargest(const char* name, uint16_t largest)
+{
+    Serial.print("  ");
+    Serial.print(name);
+    Serial.print(" largest difference ");
+    Serial.println(largest);
+}
+
+void CheckToRgb()
+{
+    uint16_t largestHsb48 = 0;
+    uint16_t largestHsl48 = 0;
+    uint16_t largestHsb = 0;
+    uint16_t largestHsl = 0;
+
+    for (uint32_t h = 0; h < 65536; h += 257)
+    {
+        for (uint32_t s = 0; s < 65536; s += 4369)
+        {
+            for (uint32_t v = 0; v < 65536; v += 4369)
+            {
+                HsbColor hsb(h / 65536.0f, s / 65535.0f, v / 65535.0f);
+                Hsb48Color hsb48(h, s, v);
+                HslColor hsl(h / 65536.0f, s / 65535.0f, v / 65535.0f);
+                Hsl48Color hsl48(h, s, v);
+
+                uint16_t difference = LargestDifference(Rgb48Color(hsb), Rgb48Color(hsb48));
+                largestHsb48 = (difference > largestHsb48) ? difference : largestHsb48;
+
+                difference = LargestDifference(Rgb48Color(hsl), Rgb48Color(hsl48));
+                largestHsl48 = (difference > largestHsl48) ? difference : largestHsl48;
+
+                difference = LargestDifference(RgbColor(hsb), RgbColor(hsb48));
+                largestHsb = (difference > largestHsb) ? difference : largestHsb;
+
+                difference = LargestDifference(RgbColor(hsl), RgbColor(hsl48));
+                largestHsl = (difference > largestHsl) ? difference : largestHsl;
+            }
+        }
+        yield(); // long loop, keep the watchdog fed
+    }
+
+    PrintLargest("Hsb48Color to Rgb48Color", largestHsb48);
+    Check(largestHsb48 <= Rgb48Tolerance, "Hsb48Color to Rgb48Color");
+    PrintLargest("Hsl48Color to Rgb48Color", largestHsl48);
+    Check(largestHsl48 <= Rgb48Tolerance, "Hsl48Color to Rgb48Color");
+    PrintLargest("Hsb48Color to RgbColor", largestHsb);
+    Check(largestHsb <= RgbTolerance, "Hsb48Color to RgbColor");
+    PrintLargest("Hsl48Color to RgbColor", largestHsl);
+    Check(largestHsl <= RgbTolerance, "Hsl48Color to RgbColor");
+}
+
+void CheckFromRgb()
+{
+    uint16_t largestHsbHue = 0;
+    uint16_t largestHsb = 0;
+    uint16_t largestHslHue = 0;
+    uint16_t largestHsl = 0;
+
+    for (uint16_t r = 0; r < 256; r += 5)
+    {
+        for (uint16_t g = 0; g < 256; g += 5)
+        {
+            for (uint16_t b = 0; b < 256; b += 5)
+            {
+                RgbColor color(r, g, b);
+                HsbColor hsb(color);
+                Hsb48Color hsb48(color);
+                HslColor hsl(color);
+                Hsl48Color hsl48(color);
+                uint16_t difference;
+
+                // the hue is meaningless without saturation
+                if (hsb48.S != 0)
+                {
+                    difference = HueDifference(static_cast<uint16_t>(hsb.H * 65536.0f), hsb48.H);
+                    largestHsbHue = (difference > largestHsbHue) ? difference : largestHsbHue;
+                }
+                difference = Difference(static_cast<uint16_t>(hsb.S * 65535.0f), hsb48.S);
+                largestHsb = (difference > largestHsb) ? difference : largestHsb;
+                difference = Difference(static_cast<uint16_t>(hsb.B * 65535.0f), hsb48.B);
+                largestHsb = (difference > largestHsb) ? difference : largestHsb;
+
+                if (hsl48.S != 0)
+                {
+                    difference = HueDifference(static_cast<uint16_t>(hsl.H * 65536.0f), hsl48.H);
+                    largestHslHue = (difference > largestHslHue) ? difference : largestHslHue;
+                }
+                difference = Difference(static_cast<uint16_t>(hsl.S * 65535.0f), hsl48.S);
+                largestHsl = (difference > largestHsl) ? difference : largestHsl;
+                difference = Difference(static_cast<uint16_t>(hsl.L * 65535.0f), hsl48.L);
+                largestHsl = (difference > largestHsl) ? difference : largestHsl;
+            }
+        }
+        yield(); // long loop, keep the watchdog fed
+    }
+
+    PrintLargest("RgbColor to Hsb48Color hue", largestHsbHue);
+    Check(largestHsbHue <= HueTolerance, "RgbColor to Hsb48Color hue");
+    PrintLargest("RgbColor to Hsb48Color saturation and brightness", largestHsb);
+    Check(largestHsb <= ComponentTolerance, "RgbColor to Hsb48Color saturation and brightness");
+    PrintLargest("RgbColor to Hsl48Color hue", largestHslHue);
+    Check(largestHslHue <= HueTolerance, "RgbColor to Hsl48Color hue");
+    PrintLargest("RgbColor to Hsl48Color saturation and lightness", largestHsl);
+    Check(largestHsl <= ComponentTolerance, "RgbColor to Hsl48Color saturation and lightness");
+}
+
+void PrintTime(const char* name, uint32_t time)
+{
+    Serial.print("  ");
+    Serial.print(name);
+    Serial.print(" ");
+    Serial.print(time);
+    Serial.print("us for ");
+    Serial.print(BenchmarkCount);
+    Serial.println(" conversions");
+}
+
+void Benchmark()
+{
+    // the sink keeps the conversions from being optimized away
+    volatile uint16_t sink = 0;
+    uint32_t start;
+
+    start = micros();
+    for (uint16_t index = 0; index < BenchmarkCount; index++)
+    {
+        RgbColor color(HsbColor(index / 4096.0f, 1.0f, 0.5f));
+        sink += color.R;
+    }
+    PrintTime("HsbColor to RgbColor", micros() - start);
+
+    start = micros();
+    for (uint16_t index = 0; index < BenchmarkCount; index++)
+    {
+        RgbColor color(Hsb48Color(index << 4, 65535, 32768));
+        sink += color.R;
+    }
+    PrintTime("Hsb48Color to RgbColor", micros() - start);
+
+    start = micros();
+    for (uint16_t index = 0; index < BenchmarkCount; index++)
+    {
+        RgbColor color(HslColor(index / 4096.0f, 1.0f, 0.5f));
+        sink += color.R;
+    }
+    PrintTime("HslColor to RgbColor", micros() - start);
+
+    start = micros();
+    for (uint16_t index = 0; index < BenchmarkCount; index++)
+    {
+        RgbColor color(Hsl48Color(index << 4, 65535, 32768));
+        sink += color.R;
+    }
+    PrintTime("Hsl48Color to RgbColor", micros() - start);
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial); // wait for serial attach
+
+    Serial.println();
+    Serial.println("Running...");
+
+    CheckToRgb();
+    CheckFromRgb();
+
+    Serial.println();
+    Serial.print(failures);
+    Serial.println(" failures");
+
+    Serial.println();
+    Serial.println("Benchmark...");
+    Benchmark();
+}
+
+void loop()
+{
+}
@@ -0,0 +1,250 @@
+//----------------------------------------------------------------------
+// NeoChunkedDmaEncoderTest
+// This will check that streaming a frame chunk by chunk through 
+// NeoChunkedDmaEncoder, as a method does from its DMA interrupt, sends 
+// exactly what encoding the whole frame at once followed by the idle 
+// signal would, across frame sizes that end within, on and just past a
+// chunk, for encoders that pad to whole words and write past the end 
+// (DmaOverrun, ChunkDataAlignment) and for ones that don't.
+//
+// The encoders are platform independent, so no led strip needs to be 
+// connected, the results are on the Serial monitor
+//----------------------------------------------------------------------
+
+#include <NeoPixelBus.h>
+#include <internal/methods/NeoChunkedDmaEncoder.h>
+#include <internal/methods/NeoNrf52xPwmEncoder.h>
+
+// the nRF52 pwm encoder, one 16 bit value per bit
+struct TestPwmSpeed
+{
+    const static uint16_t Bit0 = 6 | 0x8000;
+    const static uint16_t Bit1 = 13 | 0x8000;
+    const static uint16_t BitReset = 0x8000;
+};
+
+typedef NeoNrf52xPwmEncoder<TestPwmSpeed> TestPwmEncoder;
+
+// a 3 step cadence packed into 32 bit words, most significant bit first,
+// that pads to whole words and always stores one more word, the same
+// contract as the ESP8266 3 step dma encoder
+class TestWordPackedEncoder
+{
+public:
+    const static size_t DmaBytesPerDataByte = 3;
+    const static size_t ChunkDataAlignment = 4; // whole 32 bit dma words
+    const static size_t DmaOverrun = sizeof(uint32_t); // the remaining bits store
+
+    static void EncodeIntoDma(uint8_t* dmaBuffer, const uint8_t* data, size_t sizeData)
+    {
+        uint32_t* pDma = reinterpret_cast<uint32_t*>(dmaBuffer);
+        uint32_t dmaValue = 0;
+        uint8_t destBitsLeft = 32;
+
+        for (size_t index = 0; index < sizeData; index++)
+        {
+            for (uint8_t bit = 0x80; bit != 0; bit >>= 1)
+            {
+                uint8_t symbol = (data[index] & bit) ? 0b110 : 0b100;
+
+                for (uint8_t step = 0x04; step != 0; step >>= 1)
+                {
+                    destBitsLeft--;
+                    if (symbol & step)
+                    {
+                        dmaValue |= static_cast<uint32_t>(1) << destBitsLeft;
+                    }
+                    if (destBitsLeft == 0)
+                    {
+                        *(pDma++) = dmaValue;
+                        dmaValue = 0;
+                        destBitsLeft = 32;
+                    }
+                }
+            }
+        }
+        *(pDma++) = dmaValue;
+    }
+
+    static size_t EncodedDmaSize(size_t sizeData)
+    {
+        return ((sizeData * DmaBytesPerDataByte + 3) / 4) * 4;
+    }
+
+    static void FillIdleDma(uint8_t* dmaBuffer, size_t sizeDma)
+    {
+        memset(dmaBuffer, 0x00, sizeDma);
+    }
+};
+
+const size_t MaxDataSize = 40;
+const uint8_t GuardValue = 0xa5;
+const size_t GuardSize = 8;
+
+uint8_t data[MaxDataSize];
+uint16_t failures = 0;
+
+void Check(bool passed, const char* description)
+{
+    if (!passed)
+    {
+        Serial.print("FAIL ");
+        Serial.println(description);
+        failures++;
+    }
+}
+
+template <typename T_CHUNKED> 
+void CheckFrame(const char* name, size_t sizeData, size_t sizeResetDma)
+{
+    typedef typename T_CHUNKED::Policy Policy;
+
+    const size_t sizeDma = sizeData * Policy::DmaBytesPerDataByte + sizeResetDma;
+    const size_t countChunks = (sizeDma + T_CHUNKED::ChunkDmaSize - 1) / T_CHUNKED::ChunkDmaSize;
+    const size_t sizeStream = countChunks * T_CHUNKED::ChunkDmaSize;
+
+    // the whole frame at once, followed by idle to the end of the last chunk
+    uint8_t* expected = static_cast<uint8_t*>(malloc(sizeStream + Policy::DmaOverrun));
+    // what the dma would have sent
+    uint8_t* sent = static_cast<uint8_t*>(malloc(sizeStream));
+    uint8_t* dmaBuffer = static_cast<uint8_t*>(malloc(T_CHUNKED::DmaBufferSize + GuardSize));
+
+    if (expected == nullptr || sent == nullptr || dmaBuffer == nullptr)
+    {
+        Check(false, "memory allocation");
+        free(expected);
+        free(sent);
+        free(dmaBuffer);
+        return;
+    }
+
+    size_t sizeEncoded = 0;
+
+    if (sizeData)
+    {
+        Policy::EncodeIntoDma(expected, data, sizeData);
+        sizeEncoded = Policy::EncodedDmaSize(sizeData);
+    }
+    Policy::FillIdleDma(expected + sizeEncoded, sizeStream - sizeEncoded);
+
+    memset(dmaBuffer, GuardValue, T_CHUNKED::DmaBufferSize + GuardSize);
+
+    T_CHUNKED chunked;
+    bool isOrdered = true;
+    bool isDone = false;
+
+    chunked.Attach(dmaBuffer);
+    Check(chunked.Start(data, sizeData, sizeResetDma) == countChunks, "chunk count");
+    isDone = chunked.IsDone(); // an empty frame has no chunks to send
+
+    // as the dma would, send each slot in turn and refill it once sent
+    for (size_t chunk = 0; chunk < countChunks; chunk++)
+    {
+        uint8_t slot = chunk % T_CHUNKED::SlotCount;
+
+        isOrdered = isOrdered && (chunked.NextSlot() == slot) && !isDone;
+        memcpy(sent + chunk * T_CHUNKED::ChunkDmaSize, chunked.Slot(slot), T_CHUNKED::ChunkDmaSize);
+        isDone = chunked.ChunkSent();
+    }
+
+    bool isGuardIntact = true;
+
+    for (size_t index = 0; index < GuardSize; index++)
+    {
+        isGuardIntact = isGuardIntact && (dmaBuffer[T_CHUNKED::DmaBufferSize + index] == GuardValue);
+    }
+
+    bool isMatch = (memcmp(sent, expected, sizeStream) == 0);
+
+    if (!isOrdered || !isDone || !isMatch || !isGuardIntact)
+    {
+        Serial.print(name);
+        Serial.print(" data ");
+        Serial.print(sizeData);
+        Serial.print(" reset ");
+        Serial.print(sizeResetDma);
+        Serial.print(" chunks ");
+        Serial.println(countChunks);
+    }
+
+    Check(isOrdered, "slots refilled in order");
+    Check(isDone && chunked.IsDone(), "done after the last chunk");
+    Check(isMatch, "streamed chunks match the whole frame");
+    Check(isGuardIntact, "no writes past the dma buffer");
+
+    free(expected);
+    free(sent);
+    free(dmaBuffer);
+}
+
+template <typename T_CHUNKED> void CheckFrames(const char* name)
+{
+    uint16_t failuresBefore = failures;
+
+    const size_t chunk = T_CHUNKED::ChunkDataSize;
+    const size_t sizes[] = { 0, 1, 2, 3, 4, 5, 7, 
+        chunk - 1, chunk, chunk + 1, 
+        2 * chunk - 1, 2 * chunk, 2 * chunk + 3, 
+        MaxDataSize - 1, MaxDataSize };
+
+    for (size_t index = 0; index < sizeof(sizes) / sizeof(sizes[0]); index++)
+    {
+        if (sizes[index] > MaxDataSize)
+        {
+            continue;
+        }
+
+        CheckFrame<T_CHUNKED>(name, sizes[index], 0);
+        CheckFrame<T_CHUNKED>(name, sizes[index], T_CHUNKED::ChunkDmaSize / 2);
+        CheckFrame<T_CHUNKED>(name, sizes[index], T_CHUNKED::ChunkDmaSize * 2 + 4);
+    }
+
+    Serial.print((failures == failuresBefore) ? "PASS " : "FAIL ");
+    Serial.println(name);
+}
+
+// exposes the policy for the checks
+template <typename T_POLICY, size_t V_CHUNK_DATA_SIZE, uint8_t V_SLOT_COUNT = 2> 
+class TestChunked : public NeoChunkedDmaEncoder<T_POLICY, V_CHUNK_DATA_SIZE, V_SLOT_COUNT>
+{
+public:
+    typedef T_POLICY Policy;
+};
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial); // wait for serial attach
+
+    Serial.println();
+    Serial.println("Running...");
+
+    for (size_t index = 0; index < MaxDataSize; index++)
+    {
+        data[index] = index * 37 + 11;
+    }
+
+    CheckFrames<TestChunked<TestPwmEncoder, 1>>("pwm chunk 1");
+    CheckFrames<TestChunked<TestPwmEncoder, 5>>("pwm chunk 5");
+    CheckFrames<TestChunked<TestPwmEncoder, 16, 3>>("pwm chunk 16 slots 3");
+    CheckFrames<TestChunked<TestWordPackedEncoder, 4>>("word packed chunk 4");
+    CheckFrames<TestChunked<TestWordPackedEncoder, 12>>("word packed chunk 12");
+    CheckFrames<TestChunked<TestWordPackedEncoder, 8, 4>>("word packed chunk 8 slots 4");
+
+    // the platform's own dma encoders
+#if defined(ARDUINO_ARCH_ESP8266)
+    CheckFrames<TestChunked<NeoEsp8266Dma3StepEncode<NeoEsp8266DmaNormalPattern>, 8>>("esp8266 3 step chunk 8");
+    CheckFrames<TestChunked<NeoEsp8266Dma4StepEncode<NeoEsp8266DmaInvertedPattern>, 5>>("esp8266 4 step chunk 5");
+#elif defined(ARDUINO_ARCH_ESP32) && !defined(CONFIG_IDF_TARGET_ESP32C3) && !defined(CONFIG_IDF_TARGET_ESP32S3)
+    CheckFrames<TestChunked<NeoEsp32I2sCadence3Step, 8>>("esp32 i2s 3 step chunk 8");
+    CheckFrames<TestChunked<NeoEsp32I2sCadence4Step, 5>>("esp32 i2s 4 step chunk 5");
+#endif
+
+    Serial.println();
+    Serial.print(failures);
+    Serial.println(" failures");
+}
+
+void loop()
+{
+}
@@ -0,0 +1,217 @@
+//----------------------------------------------------------------------
+// NeoDmx512EncoderTest
+// This will decode the bit stream from NeoDmx512Encoder as a DMX512 or 
+// WS2821 receiver would, checking the Break and Mark After Break are at 
+// least their minimum times, that every slot has a space start bit, the 
+// data least significant bit first and two mark stop bits, that the slots 
+// decode back to the data, and that the rest of the stream is mark.
+// Both protocols are checked, normal and inverted, into 8 and 32 bit words.
+//
+// The encoder is platform independent, so no led strip needs to be 
+// connected, the results are on the Serial monitor
+//----------------------------------------------------------------------
+
+#include <NeoPixelBus.h>
+#include <internal/methods/NeoDmx512Encoder.h>
+
+// the bit rate and receiver minimums of each protocol, the times are 
+// taken from the bit rate as BitSendTimeNs is truncated for WS2821
+struct Dmx512Timing
+{
+    typedef NeoDmx512Protocol Protocol;
+    const static uint32_t BitsPerSecond = 250000;
+    const static uint32_t MinBreakNs = 92000;
+    const static uint32_t MinMabNs = 12000;
+};
+
+struct Ws2821Timing
+{
+    typedef NeoWs2821Protocol Protocol;
+    const static uint32_t BitsPerSecond = 750000;
+    const static uint32_t MinBreakNs = 88000;
+    const static uint32_t MinMabNs = 4000;
+};
+
+const size_t MaxDataSize = 64;
+
+uint8_t data[MaxDataSize];
+uint16_t failures = 0;
+
+void Check(bool passed, const char* description)
+{
+    if (!passed)
+    {
+        Serial.print("FAIL ");
+        Serial.println(description);
+        failures++;
+    }
+}
+
+// the signal level of a bit of the stream, most significant bit first
+template <typename T_TIMING> uint32_t BitsToNs(size_t bits)
+{
+    return static_cast<uint64_t>(bits) * 1000000000 / T_TIMING::BitsPerSecond;
+}
+
+template <typename T_WORD> bool IsMark(const T_WORD* stream, size_t bit, bool inverted)
+{
+    const size_t WordBits = sizeof(T_WORD) * 8;
+    bool isHigh = (stream[bit / WordBits] >> (WordBits - 1 - (bit % WordBits))) & 1;
+
+    return isHigh != inverted;
+}
+
+template <typename T_TIMING, typename T_INVERT, typename T_WORD> 
+void CheckFrame(size_t sizeData)
+{
+    typedef NeoDmx512Encoder<T_INVERT> Encoder;
+    typedef typename T_TIMING::Protocol Protocol;
+
+    const size_t WordBits = sizeof(T_WORD) * 8;
+    const bool inverted = T_INVERT::Inverted;
+    const size_t sizeEncoded = Encoder::template EncodedSize<T_WORD>(sizeData, Protocol::BreakMabBits);
+    const size_t sizeStream = sizeEncoded + 2; // more than needed, so the mark fill is seen
+
+    T_WORD* stream = static_cast<T_WORD*>(malloc(sizeStream * sizeof(T_WORD)));
+
+    if (stream == nullptr)
+    {
+        Check(false, "memory allocation");
+        return;
+    }
+
+    Encoder::template Encode<T_WORD>(data, data + sizeData, stream, stream + sizeStream, Protocol::BreakMabBits);
+
+    const size_t bitCount = sizeStream * WordBits;
+    size_t bit = 0;
+    size_t breakBits = 0;
+    size_t mabBits = 0;
+    size_t slotsDecoded = 0;
+    bool isFramed = true;
+    bool isDataMatch = true;
+    bool isMarkAfter = true;
+
+    // Break, space
+    while (bit < bitCount && !IsMark(stream, bit, inverted))
+    {
+        breakBits++;
+        bit++;
+    }
+
+    // Mab, mark until the first start bit
+    while (bit < bitCount && IsMark(stream, bit, inverted))
+    {
+        mabBits++;
+        bit++;
+    }
+
+    // the space that ended the Mab is the start bit of the first slot
+    if (sizeData)
+    {
+        while (slotsDecoded < sizeData && bit + Encoder::SlotBits <= bitCount)
+        {
+            uint8_t value = 0;
+
+            isFramed = isFramed && !IsMark(stream, bit, inverted); // start bit
+            for (uint8_t index = 0; index < 8; index++)
+            {
+                if (IsMark(stream, bit + 1 + index, inverted))
+                {
+                    value |= 1 << index; // least significant bit first
+                }
+            }
+            isFramed = isFramed && IsMark(stream, bit + 9, inverted) && IsMark(stream, bit + 10, inverted); // stop bits
+            isDataMatch = isDataMatch && (value == data[slotsDecoded]);
+
+            bit += Encoder::SlotBits;
+            slotsDecoded++;
+        }
+    }
+
+    // Mtbp and the rest, mark
+    while (bit < bitCount)
+    {
+        isMarkAfter = isMarkAfter && IsMark(stream, bit, inverted);
+        bit++;
+    }
+
+    bool isBreakLength = (breakBits == Protocol::BreakMabBits - Encoder::MabBits) &&
+        (BitsToNs<T_TIMING>(breakBits) >= T_TIMING::MinBreakNs);
+    // without slots the Mab runs into the trailing mark
+    bool isMabLength = (sizeData == 0) ||
+        ((mabBits == Encoder::MabBits) && (BitsToNs<T_TIMING>(mabBits) >= T_TIMING::MinMabNs));
+    bool isSizeEnough = (Protocol::BreakMabBits + sizeData * Encoder::SlotBits <= sizeEncoded * WordBits);
+
+    if (!isBreakLength || !isMabLength || !isSizeEnough || 
+        !isFramed || !isDataMatch || slotsDecoded != sizeData || !isMarkAfter)
+    {
+        Serial.print("data ");
+        Serial.print(sizeData);
+        Serial.print(" word bits ");
+        Serial.print(WordBits);
+        Serial.print(" break bits ");
+        Serial.print(breakBits);
+        Serial.print(" mab bits ");
+        Serial.println(mabBits);
+    }
+
+    Check(isBreakLength, "break length");
+    Check(isMabLength, "mark after break length");
+    Check(isSizeEnough, "encoded size holds every slot");
+    Check(isFramed, "start and stop bits");
+    Check(isDataMatch && slotsDecoded == sizeData, "slots decode to the data");
+    Check(isMarkAfter, "mark after the last slot");
+
+    free(stream);
+}
+
+template <typename T_TIMING, typename T_INVERT> void CheckProtocol(const char* name)
+{
+    const size_t sizes[] = { 0, 1, 2, 3, 5, 8, 13, 32, MaxDataSize };
+    uint16_t failuresBefore = failures;
+
+    Check(T_TIMING::Protocol::BitSendTimeNs == 1000000000 / T_TIMING::BitsPerSecond, "bit send time");
+
+    for (size_t index = 0; index < sizeof(sizes) / sizeof(sizes[0]); index++)
+    {
+        CheckFrame<T_TIMING, T_INVERT, uint8_t>(sizes[index]);
+        CheckFrame<T_TIMING, T_INVERT, uint32_t>(sizes[index]);
+    }
+
+    Serial.print((failures == failuresBefore) ? "PASS " : "FAIL ");
+    Serial.println(name);
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial); // wait for serial attach
+
+    Serial.println();
+    Serial.println("Running...");
+
+    // the start code, then the edge values, then a spread of the rest
+    data[0] = 0x00;
+    data[1] = 0xff;
+    data[2] = 0x01;
+    data[3] = 0x80;
+    data[4] = 0x55;
+    data[5] = 0xaa;
+    for (size_t index = 6; index < MaxDataSize; index++)
+    {
+        data[index] = index * 37 + 11;
+    }
+
+    CheckProtocol<Dmx512Timing, NeoBitsNotInverted>("DMX512");
+    CheckProtocol<Dmx512Timing, NeoBitsInverted>("DMX512 inverted");
+    CheckProtocol<Ws2821Timing, NeoBitsNotInverted>("WS2821");
+    CheckProtocol<Ws2821Timing, NeoBitsInverted>("WS2821 inverted");
+
+    Serial.println();
+    Serial.print(failures);
+    Serial.println(" failures");
+}
+
+void loop()
+{
+}
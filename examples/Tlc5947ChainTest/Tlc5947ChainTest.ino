@@ -0,0 +1,190 @@
+//----------------------------------------------------------------------
+// Tlc5947ChainTest
+// This will check what Tlc5947MethodBase sends for chains of 1 to 12 
+// modules, with both the 8 bit and 16 bit converters, against the 
+// per module output built here from the channels as 12 bit values, the
+// last channel first.  The sent bytes are captured rather than sent, and
+// the number of transfers is checked, one for the whole chain buffer or
+// one for each module without it.
+//
+// Comment out the NPB_CONF_TLC5947_CHAIN_BUFFER below to check the per
+// module mode instead.
+//
+// No Tlc5947 needs to be connected, the results are on the Serial monitor
+//----------------------------------------------------------------------
+
+#define NPB_CONF_TLC5947_CHAIN_BUFFER
+
+#include <NeoPixelBus.h>
+
+const uint8_t LatchPin = 2; // toggled by each Update
+const uint16_t MaxModules = 12;
+const size_t MaxSendSize = MaxModules * 36;
+
+uint8_t sent[MaxSendSize + 8];
+size_t sizeSent;
+uint16_t transfers;
+uint8_t expected[MaxSendSize];
+uint16_t failures = 0;
+
+// captures the bytes that would be sent
+class CaptureTwoWire
+{
+public:
+    typedef NeoNoSettings SettingsObject;
+
+    CaptureTwoWire(uint8_t, uint8_t)
+    {
+    }
+
+    void begin()
+    {
+    }
+
+    void beginTransaction()
+    {
+        sizeSent = 0;
+        transfers = 0;
+    }
+
+    void endTransaction()
+    {
+    }
+
+    void transmitBytes(const uint8_t* data, size_t dataSize)
+    {
+        for (size_t index = 0; index < dataSize; index++)
+        {
+            if (sizeSent < sizeof(sent))
+            {
+                sent[sizeSent] = data[index];
+            }
+            sizeSent++;
+        }
+        transfers++;
+    }
+
+    void applySettings([[maybe_unused]] const SettingsObject& settings)
+    {
+    }
+};
+
+void Check(bool passed, const char* description)
+{
+    Serial.print(passed ? "PASS " : "FAIL ");
+    Serial.println(description);
+    if (!passed)
+    {
+        failures++;
+    }
+}
+
+// the 12 bit value of a channel
+uint16_t Channel12Bit(const uint8_t* data, size_t channel, size_t sizeChannel)
+{
+    if (sizeChannel == 1)
+    {
+        // scaled, the top bits repeated into the bottom
+        return (static_cast<uint16_t>(data[channel]) << 4) | (data[channel] >> 4);
+    }
+
+    uint16_t value;
+
+    memcpy(&value, data + channel * sizeof(uint16_t), sizeof(uint16_t));
+    return value >> 4;
+}
+
+// each module is sent as 24 channels of 12 bits, most significant bit 
+// first, and the first module sent holds the last channels
+size_t ExpectedOutput(const uint8_t* data, uint16_t countModule, size_t sizeChannel)
+{
+    const size_t countChannel = countModule * 24;
+    uint8_t* pExpected = expected;
+
+    for (size_t channel = countChannel; channel > 0; channel -= 2)
+    {
+        uint16_t ch1 = Channel12Bit(data, channel - 1, sizeChannel);
+        uint16_t ch2 = Channel12Bit(data, channel - 2, sizeChannel);
+
+        *(pExpected++) = ch1 >> 4;
+        *(pExpected++) = (ch1 << 4) | (ch2 >> 8);
+        *(pExpected++) = ch2;
+    }
+    return pExpected - expected;
+}
+
+template <typename T_BITCONVERT> void CheckConverter(const char* name, size_t pixelSize)
+{
+    bool passed = true;
+
+    for (uint16_t pixelCount = 1; pixelCount * pixelSize / T_BITCONVERT::sizeChannel <= MaxModules * 24; pixelCount++)
+    {
+        Tlc5947MethodBase<T_BITCONVERT, CaptureTwoWire> method(LatchPin, pixelCount, pixelSize, 0);
+        const uint16_t countModule = (pixelCount * pixelSize / T_BITCONVERT::sizeChannel + 23) / 24;
+
+        method.Initialize();
+
+        // the buffer holds whole modules of channels
+        bool isSizeCorrect = (method.getDataSize() == countModule * 24 * T_BITCONVERT::sizeChannel);
+        uint8_t* data = method.getData();
+
+        for (size_t index = 0; index < method.getDataSize(); index++)
+        {
+            data[index] = random(256);
+        }
+
+        method.Update(false);
+
+        size_t sizeExpected = ExpectedOutput(data, countModule, T_BITCONVERT::sizeChannel);
+
+#if defined(NPB_CONF_TLC5947_CHAIN_BUFFER)
+        const uint16_t expectedTransfers = 1;
+#else
+        const uint16_t expectedTransfers = countModule;
+#endif
+        bool isOutputCorrect = (sizeSent == sizeExpected) &&
+            (memcmp(sent, expected, sizeExpected) == 0);
+
+        if (!isSizeCorrect || !isOutputCorrect || transfers != expectedTransfers)
+        {
+            Serial.print("  mismatch for pixel count ");
+            Serial.print(pixelCount);
+            Serial.print(" modules ");
+            Serial.print(countModule);
+            Serial.print(" sent ");
+            Serial.print(sizeSent);
+            Serial.print(" in ");
+            Serial.print(transfers);
+            Serial.println(" transfers");
+            passed = false;
+        }
+    }
+
+    Check(passed, name);
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial); // wait for serial attach
+
+    Serial.println();
+#if defined(NPB_CONF_TLC5947_CHAIN_BUFFER)
+    Serial.println("Running with the whole chain buffer...");
+#else
+    Serial.println("Running per module...");
+#endif
+
+    CheckConverter<Tlc5947Converter8Bit>("8 bit converter, Rgb pixels", 3);
+    CheckConverter<Tlc5947Converter8Bit>("8 bit converter, Rgbw pixels", 4);
+    CheckConverter<Tlc5947Converter16Bit>("16 bit converter, Rgb48 pixels", 6);
+    CheckConverter<Tlc5947Converter16Bit>("16 bit converter, Rgbw64 pixels", 8);
+
+    Serial.println();
+    Serial.print(failures);
+    Serial.println(" failures");
+}
+
+void loop()
+{
+}
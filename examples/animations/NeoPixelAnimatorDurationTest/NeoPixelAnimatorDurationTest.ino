@@ -0,0 +1,96 @@
+//----------------------------------------------------------------------
+// NeoPixelAnimatorDurationTest
+// This will check that changing the duration of running animations,
+// including ones that are nearly finished, keeps the animator consistent
+// so that restarting them and finding available animations still works.
+//
+// It uses NeoVirtualClock so the results are the same on every run and 
+// no led strip needs to be connected, the results are on the Serial monitor
+//----------------------------------------------------------------------
+
+#include <NeoPixelAnimator.h>
+
+typedef NeoPixelAnimatorBase<uint16_t, NeoVirtualClock> TestAnimator;
+
+const uint16_t AnimationCount = 4;
+
+TestAnimator animations(AnimationCount, NEO_MILLISECONDS);
+
+uint16_t failures = 0;
+
+void AnimUpdate(const AnimationParam& param)
+{
+}
+
+void Check(bool passed, const char* description)
+{
+    Serial.print(passed ? "PASS " : "FAIL ");
+    Serial.println(description);
+
+    if (!passed)
+    {
+        failures++;
+    }
+}
+
+void StartAll()
+{
+    animations.StopAll();
+    for (uint16_t index = 0; index < AnimationCount; index++)
+    {
+        animations.StartAnimation(index, 1000, AnimUpdate);
+    }
+}
+
+// advance the virtual time and update the animations
+void Run(uint32_t milliseconds)
+{
+    NeoVirtualClock::Advance(milliseconds * 1000);
+    animations.UpdateAnimations();
+}
+
+void CheckChangeNearEnd(uint16_t newDuration, const char* description)
+{
+    uint16_t indexAvailable;
+
+    StartAll();
+    Run(999); // nearly finished
+
+    animations.ChangeAnimationDuration(3, newDuration);
+    Serial.println(description);
+    Check(animations.IsAnimationActive(3), "changed animation is still active");
+    Check(!animations.NextAvailableAnimation(&indexAvailable), "no animation is available while all are active");
+
+    animations.StartAnimation(3, 1000, AnimUpdate);
+    Check(animations.IsAnimationActive(3), "restarted animation is active");
+    Check(!animations.NextAvailableAnimation(&indexAvailable), "no animation is available after restart");
+
+    animations.StopAnimation(2);
+    Check(animations.NextAvailableAnimation(&indexAvailable) && indexAvailable == 2, "stopped animation is the available one");
+    Check(animations.IsAnimationActive(3), "restarted animation is still active");
+
+    Run(1000);
+    Check(!animations.IsAnimating(), "all animations complete");
+    Check(animations.NextAvailableAnimation(&indexAvailable, 3) && indexAvailable == 3, "all animations are available again");
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial); // wait for serial attach
+
+    Serial.println();
+    Serial.println("Running...");
+
+    CheckChangeNearEnd(500, "shorter duration on a nearly finished animation");
+    CheckChangeNearEnd(1, "minimum duration on a nearly finished animation");
+    CheckChangeNearEnd(0, "zero duration on a nearly finished animation");
+
+    Serial.println();
+    Serial.print(failures);
+    Serial.println(" failures");
+}
+
+void loop()
+{
+}
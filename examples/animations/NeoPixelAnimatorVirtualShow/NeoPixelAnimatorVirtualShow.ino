@@ -0,0 +1,159 @@
+//----------------------------------------------------------------------
+// NeoPixelAnimatorVirtualShow
+// This will run a 10 minute show at 400 frames per second frame by frame
+// on a virtual clock, much faster than real time, reporting the cost of
+// the animation updates and a checksum of the rendered frames as it goes.
+// The show is then run a second time and must render the same frames.
+//
+// It uses NeoVirtualClock so the results are the same on every run and 
+// no led strip needs to be connected, the results are on the Serial monitor
+//----------------------------------------------------------------------
+
+#include <NeoPixelBus.h>
+#include <NeoPixelAnimator.h>
+
+typedef NeoPixelAnimatorBase<uint16_t, NeoVirtualClock> ShowAnimator;
+
+const uint16_t PixelCount = 32;
+const uint16_t FramesPerSecond = 400;
+const uint32_t ShowSeconds = 600; // 10 minutes
+const uint32_t ReportSeconds = 60;
+
+ShowAnimator animations(PixelCount, NEO_MILLISECONDS);
+NeoFramePacer pacer(FramesPerSecond);
+RgbColor pixels[PixelCount];
+
+// stands in for the bus, it is always ready to show the next frame
+struct VirtualBus
+{
+    bool CanShow() const
+    {
+        return true;
+    }
+};
+
+VirtualBus bus;
+
+uint16_t failures = 0;
+
+void Check(bool passed, const char* description)
+{
+    Serial.print(passed ? "PASS " : "FAIL ");
+    Serial.println(description);
+
+    if (!passed)
+    {
+        failures++;
+    }
+}
+
+// each pixel pulses its own hue, with its own duration
+void AnimUpdate(const AnimationParam& param)
+{
+    float progress = NeoEase::SinusoidalInOut(param.progress);
+    RgbColor target = HslColor(param.index / static_cast<float>(PixelCount), 1.0f, 0.5f);
+
+    pixels[param.index] = RgbColor::LinearBlend(RgbColor(0), target, progress);
+
+    if (param.state == AnimationState_Completed)
+    {
+        animations.RestartAnimation(param.index);
+    }
+}
+
+// FNV-1a of the frame, chained from the previous frames
+uint32_t ChecksumFrame(uint32_t checksum)
+{
+    for (uint16_t index = 0; index < PixelCount; index++)
+    {
+        checksum = (checksum ^ pixels[index].R) * 16777619UL;
+        checksum = (checksum ^ pixels[index].G) * 16777619UL;
+        checksum = (checksum ^ pixels[index].B) * 16777619UL;
+    }
+    return checksum;
+}
+
+uint32_t RunShow(bool report)
+{
+    const uint32_t FrameCount = ShowSeconds * FramesPerSecond;
+    const uint32_t ReportFrames = ReportSeconds * FramesPerSecond;
+
+    NeoVirtualClock::SetMicros(0);
+    animations.StopAll();
+    pacer.Reset();
+    pacer.resetMissedFrames();
+
+    for (uint16_t index = 0; index < PixelCount; index++)
+    {
+        pixels[index] = RgbColor(0);
+        animations.StartAnimation(index, 500 + index * 37, AnimUpdate);
+    }
+
+    uint32_t checksum = 2166136261UL;
+    uint32_t frames = 0;
+    uint32_t costTotal = 0;
+    uint32_t costMax = 0;
+
+    while (frames < FrameCount)
+    {
+        // the real time the update takes, while the show time is virtual
+        uint32_t start = micros();
+        bool isFrame = pacer.Update(animations, bus);
+        uint32_t cost = micros() - start;
+
+        if (isFrame)
+        {
+            frames++;
+            costTotal += cost;
+            if (cost > costMax)
+            {
+                costMax = cost;
+            }
+
+            checksum = ChecksumFrame(checksum);
+
+            if (report && (frames % ReportFrames) == 0)
+            {
+                Serial.print(frames / FramesPerSecond);
+                Serial.print("s checksum ");
+                Serial.print(checksum, HEX);
+                Serial.print(" update avg ");
+                Serial.print(costTotal / ReportFrames);
+                Serial.print("us max ");
+                Serial.print(costMax);
+                Serial.println("us");
+
+                costTotal = 0;
+                costMax = 0;
+            }
+        }
+
+        NeoVirtualClock::Advance(pacer.getFrameDuration());
+    }
+
+    Check(pacer.getMissedFrames() == 0, "no frames were missed");
+    Check(animations.IsAnimating(), "all animations still running at the end");
+    return checksum;
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial); // wait for serial attach
+
+    Serial.println();
+    Serial.println("Running...");
+
+    uint32_t first = RunShow(true);
+    uint32_t second = RunShow(false);
+
+    Check(first == second, "a second run renders the same frames");
+
+    Serial.println();
+    Serial.print(failures);
+    Serial.println(" failures");
+}
+
+void loop()
+{
+}
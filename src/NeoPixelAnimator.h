@@ -28,6 +28,9 @@ License along with NeoPixel.  If not, see
 
 #include <Arduino.h>
 #include "internal/animations/NeoEase.h"
+#include "internal/animations/NeoEase16.h"
+#include "internal/animations/NeoTimeline.h"
+#include "internal/animations/NeoAnimationClocks.h"
 
 enum AnimationState
 {
@@ -39,6 +42,7 @@ enum AnimationState
 struct AnimationParam
 {
     float progress;
+    uint16_t progress16; // progress in fixed point, 0 - 65535 for 0.0 - 1.0, for use with NeoEase16
     uint16_t index;
     AnimationState state;
 };
@@ -47,6 +51,15 @@ struct AnimationParam
 
 typedef void(*AnimUpdateCallback)(const AnimationParam& param);
 
+#elif defined(NEOPIXEBUS_ANIM_CALLBACK_CAPTURE_SIZE)
+
+// a fixed capacity callback that never uses the heap, lambdas with 
+// captures larger than NEOPIXEBUS_ANIM_CALLBACK_CAPTURE_SIZE bytes will fail
+// to compile. This must be defined for the whole build (build flags), 
+// not just within the sketch
+#include "internal/animations/NeoInlineCallback.h"
+typedef NeoInlineCallback<AnimationParam, NEOPIXEBUS_ANIM_CALLBACK_CAPTURE_SIZE> AnimUpdateCallback;
+
 #else
 
 #undef max
@@ -63,11 +76,65 @@ typedef std::function<void(const AnimationParam& param)> AnimUpdateCallback;
 #define NEO_SECONDS          1000    // ~18.2 hours max duration, second updates
 #define NEO_DECASECONDS     10000    // ~7.5 days, 10 second updates
 
-class NeoPixelAnimator
+// ------------------------------------------------------------------------
+// NeoPixelAnimatorBase is the animator with a selectable duration type
+//  T_DURATION - 
+//      uint16_t - durations up to 65535 time scale units (NeoPixelAnimator)
+//      uint32_t - durations up to 4294967295 time scale units 
+//                 (NeoPixelAnimator32), for long animations that still
+//                 need fine time scale units, at the cost of 4 more bytes
+//                 per animation
+//  T_CLOCK - the time source
+//      NeoMicrosClock - micros() (default)
+//      NeoVirtualClock - time only moves when advanced
+//      or any class with a static uint32_t Micros() that returns
+//      a free running microsecond count, like one driven by a frame 
+//      counter or an RTC
+//
+// animation groups are only available when NPB_CONF_ANIMATOR_GROUPS is 
+// defined for the whole build (build flags), as they add a byte to every
+// animation and a pass over the groups to every update
+// ------------------------------------------------------------------------
+template <typename T_DURATION, typename T_CLOCK = NeoMicrosClock> class NeoPixelAnimatorBase
 {
 public:
-    NeoPixelAnimator(uint16_t countAnimations, uint16_t timeScale = NEO_MILLISECONDS);
-    ~NeoPixelAnimator();
+    typedef T_CLOCK Clock;
+
+#if defined(NPB_CONF_ANIMATOR_GROUPS)
+    NeoPixelAnimatorBase(uint16_t countAnimations, uint16_t timeScale = NEO_MILLISECONDS, uint8_t countGroups = 1) :
+        _countAnimations(countAnimations),
+        _countGroups((countGroups < 1) ? 1 : countGroups),
+#else
+    NeoPixelAnimatorBase(uint16_t countAnimations, uint16_t timeScale = NEO_MILLISECONDS) :
+        _countAnimations(countAnimations),
+#endif
+        _activeHead(InvalidIndex),
+        _updateCurrent(InvalidIndex),
+        _updateNext(InvalidIndex),
+        _animationLastTick(0),
+        _activeAnimations(0),
+        _isRunning(true)
+    {
+        setTimeScale(timeScale);
+        _animations = new AnimationContext[_countAnimations];
+#if defined(NPB_CONF_ANIMATOR_GROUPS)
+        _groups = new GroupContext[_countGroups];
+#endif
+
+        uint16_t countWords = _activeWordCount();
+
+        _activeBits = new uint32_t[countWords];
+        memset(_activeBits, 0, countWords * sizeof(uint32_t));
+    }
+
+    ~NeoPixelAnimatorBase()
+    {
+        delete[] _animations;
+#if defined(NPB_CONF_ANIMATOR_GROUPS)
+        delete[] _groups;
+#endif
+        delete[] _activeBits;
+    }
 
     bool IsAnimating() const
     {
@@ -75,11 +142,95 @@ public:
     }
 
 
-    bool NextAvailableAnimation(uint16_t* indexAvailable, uint16_t indexStart = 0);
+    bool NextAvailableAnimation(uint16_t* indexAvailable, uint16_t indexStart = 0)
+    {
+        if (_activeAnimations >= _countAnimations)
+        {
+            return false;
+        }
+
+        if (indexStart >= _countAnimations)
+        {
+            // last one
+            indexStart = _countAnimations - 1;
+        }
+
+        // the first free animation at or after indexStart, 
+        // wrapping around to the start
+        uint16_t found = _findInactive(indexStart, _countAnimations);
+
+        if (found == InvalidIndex)
+        {
+            found = _findInactive(0, indexStart);
+        }
+
+        if (indexAvailable)
+        {
+            *indexAvailable = found;
+        }
+        return true;
+    }
+
+    void StartAnimation(uint16_t indexAnimation, T_DURATION duration, AnimUpdateCallback animUpdate)
+    {
+        if (indexAnimation >= _countAnimations || animUpdate == NULL)
+        {
+            return;
+        }
+
+        if (_activeAnimations == 0)
+        {
+            _animationLastTick = T_CLOCK::Micros();
+        }
+
+        StopAnimation(indexAnimation);
+
+        // all animations must have at least non zero duration, otherwise
+        // they are considered stopped
+        if (duration == 0)
+        {
+            duration = 1;
+        }
+
+        _animations[indexAnimation].StartAnimation(duration, animUpdate);
+
+        // kept in index order so updates happen in index order, and so an 
+        // animation started from within an update callback with a higher 
+        // index than the one being updated is still updated this tick
+        _linkInOrder(indexAnimation);
+        _setActive(indexAnimation, true);
+        _activeAnimations++;
+    }
+
+    void StopAnimation(uint16_t indexAnimation)
+    {
+        if (indexAnimation >= _countAnimations)
+        {
+            return;
+        }
+
+        if (IsAnimationActive(indexAnimation))
+        {
+            _activeAnimations--;
+            _animations[indexAnimation].StopAnimation();
 
-    void StartAnimation(uint16_t indexAnimation, uint16_t duration, AnimUpdateCallback animUpdate);
-    void StopAnimation(uint16_t indexAnimation);
-    void StopAll();
+            _unlink(&_activeHead, indexAnimation);
+            _setActive(indexAnimation, false);
+        }
+    }
+
+    void StopAll()
+    {
+        while (_activeHead != InvalidIndex)
+        {
+            uint16_t indexAnimation = _activeHead;
+
+            _animations[indexAnimation].StopAnimation();
+            _unlink(&_activeHead, indexAnimation);
+        }
+        memset(_activeBits, 0, _activeWordCount() * sizeof(uint32_t));
+        _activeAnimations = 0;
+    }
 
     void RestartAnimation(uint16_t indexAnimation)
     {
@@ -100,7 +251,7 @@ public:
         return (IsAnimating() && _animations[indexAnimation]._remaining != 0);
     }
 
-    uint16_t AnimationDuration(uint16_t indexAnimation)
+    T_DURATION AnimationDuration(uint16_t indexAnimation)
     {
         if (indexAnimation >= _countAnimations)
         {
@@ -109,9 +260,142 @@ public:
         return _animations[indexAnimation]._duration;
     }
 
-    void ChangeAnimationDuration(uint16_t indexAnimation, uint16_t newDuration);
+    void ChangeAnimationDuration(uint16_t indexAnimation, T_DURATION newDuration)
+    {
+        if (indexAnimation >= _countAnimations)
+        {
+            return;
+        }
+
+        AnimationContext* pAnim = &_animations[indexAnimation];
+
+        if (pAnim->_remaining == 0)
+        {
+            // not active, nothing to rescale
+            pAnim->_duration = newDuration;
+            return;
+        }
+
+        // calc the current animation progress
+        uint32_t progress = pAnim->CurrentProgress();
+
+        // an active animation must keep a non zero duration and remaining,
+        // as a zero _remaining means it is not on the active list
+        if (newDuration == 0)
+        {
+            newDuration = 1;
+        }
+
+        // change the duration
+        pAnim->_duration = newDuration;
+
+        // _remaining time must also be reset after a duration change; 
+        // use the progress to recalculate it, rounding up so that an 
+        // animation close to completion doesn't truncate to 0 remaining
+        uint32_t remaining = 0x10000 - progress;
+
+        if (sizeof(T_DURATION) <= 2)
+        {
+            pAnim->_remaining = (static_cast<uint32_t>(newDuration) * remaining + 0xffff) >> 16;
+        }
+        else
+        {
+            pAnim->_remaining = (static_cast<uint64_t>(newDuration) * remaining + 0xffff) >> 16;
+        }
 
-    void UpdateAnimations();
+        // a duration change is never allowed to complete or stop an
+        // active animation, that only happens in UpdateAnimations
+        if (pAnim->_remaining == 0)
+        {
+            pAnim->_remaining = 1;
+        }
+    }
+
+    void UpdateAnimations()
+    {
+        if (_isRunning)
+        {
+            uint32_t currentTick = T_CLOCK::Micros();
+            uint32_t delta = currentTick - _animationLastTick;
+
+            if (delta >= _timeScale)
+            {
+                AnimationContext* pAnim;
+
+                delta /= _timeScale; // scale delta into animation time
+
+                // only consume the whole time units so the remainder 
+                // carries into the next update rather than drifting
+                _animationLastTick += delta * _timeScale;
+
+#if defined(NPB_CONF_ANIMATOR_GROUPS)
+                _updateGroupDeltas(delta);
+#endif
+
+                uint16_t iAnim = _activeHead;
+
+                while (iAnim != InvalidIndex)
+                {
+                    pAnim = &_animations[iAnim];
+                    AnimUpdateCallback fnUpdate = pAnim->_fnCallback;
+                    AnimationParam param;
+
+                    // the callback may stop or start any animation, 
+                    // _unlink() keeps _updateNext valid when that happens
+                    _updateCurrent = iAnim;
+                    _updateNext = pAnim->_next;
+
+                    param.index = iAnim;
+
+#if defined(NPB_CONF_ANIMATOR_GROUPS)
+                    uint32_t groupDelta = _groups[pAnim->_group]._delta;
+#else
+                    uint32_t groupDelta = delta;
+#endif
+
+                    if (groupDelta == 0)
+                    {
+                        // paused or slowed group with no time passed yet
+                    }
+                    else if (pAnim->_remaining > groupDelta)
+                    {
+                        param.state = (pAnim->_remaining == pAnim->_duration) ? AnimationState_Started : AnimationState_Progress;
+                        param.progress16 = pAnim->CurrentProgress();
+                        param.progress = param.progress16 * (1.0f / 65536.0f);
+
+                        fnUpdate(param);
+
+                        if (pAnim->_remaining > groupDelta)
+                        {
+                            pAnim->_remaining -= groupDelta;
+                        }
+                        else if (pAnim->_remaining != 0)
+                        {
+                            // shortened by the callback, complete on the next update
+                            pAnim->_remaining = 1;
+                        }
+                    }
+                    else
+                    {
+                        param.state = AnimationState_Completed;
+                        param.progress = 1.0f;
+                        param.progress16 = 0xffff;
+
+                        _activeAnimations--; 
+                        pAnim->StopAnimation();
+                        _unlink(&_activeHead, iAnim);
+                        _setActive(iAnim, false);
+
+                        fnUpdate(param);
+                    }
+
+                    iAnim = _updateNext;
+                }
+                _updateCurrent = InvalidIndex;
+                _updateNext = InvalidIndex;
+            }
+        }
+    }
 
     bool IsPaused()
     {
@@ -126,29 +410,134 @@ public:
     void Resume()
     {
         _isRunning = true;
-        _animationLastTick = millis();
+        _animationLastTick = T_CLOCK::Micros();
     }
 
+    // the time scale in milliseconds, 
+    // zero when a sub millisecond time scale was set
     uint16_t getTimeScale()
     {
-        return _timeScale;
+        return _timeScale / 1000;
     }
 
     void setTimeScale(uint16_t timeScale)
     {
-        _timeScale = (timeScale < 1) ? (1) : (timeScale > 32768) ? 32768 : timeScale;
+        timeScale = (timeScale < 1) ? (1) : (timeScale > 32768) ? 32768 : timeScale;
+        _timeScale = static_cast<uint32_t>(timeScale) * 1000;
+    }
+
+    // the time scale in microseconds, allowing animation time units finer 
+    // than a millisecond for high frame rates; like 
+    // setTimeScaleMicroseconds(100) for 0.1ms units with durations 
+    // up to ~6.5 seconds
+    uint32_t getTimeScaleMicroseconds()
+    {
+        return _timeScale;
+    }
+
+    void setTimeScaleMicroseconds(uint32_t timeScale)
+    {
+        _timeScale = (timeScale < 1) ? (1) : (timeScale > 32768000) ? 32768000 : timeScale;
+    }
+
+#if defined(NPB_CONF_ANIMATOR_GROUPS)
+    // ------------------------------------------------------------------------
+    // animation groups allow sets of animations, like foreground and 
+    // background effects, to be paused and sped up or slowed down 
+    // independently while still sharing one animator; all animations 
+    // start in group 0 and stay in their group across restarts
+    // ------------------------------------------------------------------------
+    uint8_t GroupCount() const
+    {
+        return _countGroups;
+    }
+
+    void SetAnimationGroup(uint16_t indexAnimation, uint8_t indexGroup)
+    {
+        if (indexAnimation >= _countAnimations || indexGroup >= _countGroups)
+        {
+            return;
+        }
+        _animations[indexAnimation]._group = indexGroup;
+    }
+
+    uint8_t AnimationGroup(uint16_t indexAnimation) const
+    {
+        if (indexAnimation >= _countAnimations)
+        {
+            return 0;
+        }
+        return _animations[indexAnimation]._group;
+    }
+
+    bool IsGroupPaused(uint8_t indexGroup) const
+    {
+        if (indexGroup >= _countGroups)
+        {
+            return false;
+        }
+        return _groups[indexGroup]._isPaused;
+    }
+
+    void PauseGroup(uint8_t indexGroup)
+    {
+        if (indexGroup < _countGroups)
+        {
+            _groups[indexGroup]._isPaused = true;
+        }
+    }
+
+    void ResumeGroup(uint8_t indexGroup)
+    {
+        if (indexGroup < _countGroups)
+        {
+            _groups[indexGroup]._isPaused = false;
+        }
+    }
+
+    // the group time multiplier in 1/256 units, 
+    // 256 is normal speed, 128 half speed, 512 double speed
+    uint16_t getGroupSpeed(uint8_t indexGroup) const
+    {
+        if (indexGroup >= _countGroups)
+        {
+            return 0;
+        }
+        return _groups[indexGroup]._speed;
+    }
+
+    void setGroupSpeed(uint8_t indexGroup, uint16_t speed)
+    {
+        if (indexGroup < _countGroups)
+        {
+            _groups[indexGroup]._speed = speed;
+        }
     }
+#endif // NPB_CONF_ANIMATOR_GROUPS
 
 private:
+    static const uint16_t InvalidIndex = 0xffff;
+
+    // active contexts are linked into the active list so that updates only
+    // touch the animations that matter rather than scanning all of them,
+    // and mirrored in a bitmap, one bit per animation, so that finding a 
+    // free one scans 32 animations at a time;
+    // a non zero _remaining is what marks a context as on the active list,
+    // so anything that changes _remaining of an active one keeps it above 0
     struct AnimationContext
     {
         AnimationContext() :
             _duration(0),
             _remaining(0),
+            _prev(InvalidIndex),
+            _next(InvalidIndex),
+#if defined(NPB_CONF_ANIMATOR_GROUPS)
+            _group(0),
+#endif
             _fnCallback(NULL)
         {}
 
-        void StartAnimation(uint16_t duration, AnimUpdateCallback animUpdate)
+        void StartAnimation(T_DURATION duration, AnimUpdateCallback animUpdate)
         {
             _duration = duration;
             _remaining = duration;
@@ -160,21 +549,234 @@ private:
             _remaining = 0;
         }
 
-        float CurrentProgress()
+        // progress in 1/65536 units
+        uint16_t CurrentProgress() const
         {
-            return (float)(_duration - _remaining) / (float)_duration;
+            T_DURATION elapsed = _duration - _remaining;
+            T_DURATION duration = _duration;
+
+            // keep the division within 32 bits by reducing 
+            // longer durations to 16 bits of precision
+            while (duration > 0xffff)
+            {
+                duration >>= 1;
+                elapsed >>= 1;
+            }
+
+            uint32_t progress = (static_cast<uint32_t>(elapsed) << 16) / duration;
+
+            return (progress > 0xffff) ? 0xffff : progress;
         }
 
-        uint16_t _duration;
-        uint16_t _remaining;
-       
+        T_DURATION _duration;
+        T_DURATION _remaining;
+        uint16_t _prev;
+        uint16_t _next;
+#if defined(NPB_CONF_ANIMATOR_GROUPS)
+        uint8_t _group;
+#endif
+
         AnimUpdateCallback _fnCallback;
     };
 
+#if defined(NPB_CONF_ANIMATOR_GROUPS)
+    struct GroupContext
+    {
+        GroupContext() :
+            _speed(256),
+            _isPaused(false),
+            _fraction(0),
+            _delta(0)
+        {}
+
+        uint16_t _speed;
+        bool _isPaused;
+        uint8_t _fraction; // sub time unit carried to the next update
+        uint32_t _delta; // time units for the current update
+    };
+#endif
+
     uint16_t _countAnimations;
     AnimationContext* _animations;
-    uint32_t _animationLastTick;
+#if defined(NPB_CONF_ANIMATOR_GROUPS)
+    uint8_t _countGroups;
+    GroupContext* _groups;
+#endif
+    uint32_t* _activeBits; // one bit per animation, set while active
+    uint16_t _activeHead;
+    uint16_t _updateCurrent; // animation being updated while within UpdateAnimations
+    uint16_t _updateNext; // next active animation while within UpdateAnimations
+    uint32_t _animationLastTick; // T_CLOCK::Micros()
     uint16_t _activeAnimations;
-    uint16_t _timeScale;
+    uint32_t _timeScale; // microseconds
     bool _isRunning;
+
+    void _unlink(uint16_t* head, uint16_t indexAnimation)
+    {
+        AnimationContext* pAnim = &_animations[indexAnimation];
+
+        if (indexAnimation == _updateNext)
+        {
+            _updateNext = pAnim->_next;
+        }
+
+        if (pAnim->_prev != InvalidIndex)
+        {
+            _animations[pAnim->_prev]._next = pAnim->_next;
+        }
+        else
+        {
+            *head = pAnim->_next;
+        }
+
+        if (pAnim->_next != InvalidIndex)
+        {
+            _animations[pAnim->_next]._prev = pAnim->_prev;
+        }
+
+        pAnim->_prev = InvalidIndex;
+        pAnim->_next = InvalidIndex;
+    }
+
+    void _linkInOrder(uint16_t indexAnimation)
+    {
+        AnimationContext* pAnim = &_animations[indexAnimation];
+        uint16_t indexPrev = _findActiveBefore(indexAnimation);
+        uint16_t* pNext = (indexPrev != InvalidIndex) ? &_animations[indexPrev]._next : &_activeHead;
+
+        pAnim->_prev = indexPrev;
+        pAnim->_next = *pNext;
+        if (*pNext != InvalidIndex)
+        {
+            _animations[*pNext]._prev = indexAnimation;
+        }
+        *pNext = indexAnimation;
+
+        // linked in between the one being updated and the next one, 
+        // so it is the next one
+        if (_updateCurrent != InvalidIndex &&
+            indexAnimation > _updateCurrent &&
+            indexAnimation < _updateNext)
+        {
+            _updateNext = indexAnimation;
+        }
+    }
+
+    uint16_t _activeWordCount() const
+    {
+        return (static_cast<uint32_t>(_countAnimations) + 31) / 32;
+    }
+
+    void _setActive(uint16_t indexAnimation, bool isActive)
+    {
+        uint32_t mask = static_cast<uint32_t>(1) << (indexAnimation % 32);
+
+        if (isActive)
+        {
+            _activeBits[indexAnimation / 32] |= mask;
+        }
+        else
+        {
+            _activeBits[indexAnimation / 32] &= ~mask;
+        }
+    }
+
+    // the lowest inactive index within first to (last - 1), 
+    // InvalidIndex if they are all active
+    uint16_t _findInactive(uint16_t first, uint16_t last) const
+    {
+        uint32_t index = first;
+
+        while (index < last)
+        {
+            uint32_t inactive = ~_activeBits[index / 32] >> (index % 32);
+
+            if (inactive == 0)
+            {
+                // the rest of this word is active, skip to the next word
+                index = (index | 31) + 1;
+            }
+            else
+            {
+                while ((inactive & 1) == 0)
+                {
+                    inactive >>= 1;
+                    index++;
+                }
+                return (index < last) ? index : InvalidIndex;
+            }
+        }
+        return InvalidIndex;
+    }
+
+    // the highest active index below indexAnimation, 
+    // InvalidIndex if there are none
+    uint16_t _findActiveBefore(uint16_t indexAnimation) const
+    {
+        uint32_t index = indexAnimation;
+
+        while (index > 0)
+        {
+            uint32_t last = index - 1;
+            uint32_t active = _activeBits[last / 32] << (31 - (last % 32));
+
+            if (active == 0)
+            {
+                // the rest of this word is inactive, skip to the previous word
+                index = last & ~static_cast<uint32_t>(31);
+            }
+            else
+            {
+                while ((active & 0x80000000) == 0)
+                {
+                    active <<= 1;
+                    last--;
+                }
+                return last;
+            }
+        }
+        return InvalidIndex;
+    }
+
+#if defined(NPB_CONF_ANIMATOR_GROUPS)
+    void _updateGroupDeltas(uint32_t delta)
+    {
+        const GroupContext* groupsEnd = _groups + _countGroups;
+
+        for (GroupContext* group = _groups; group < groupsEnd; group++)
+        {
+            if (group->_isPaused || group->_speed == 0)
+            {
+                group->_delta = 0;
+            }
+            else if (group->_speed == 256)
+            {
+                group->_delta = delta;
+            }
+            else
+            {
+                // delta * speed / 256, split so it can't overflow 
+                // and with the fraction carried to the next update
+                uint32_t whole = delta >> 8;
+                uint32_t part = (delta & 0xff) * group->_speed + group->_fraction;
+
+                group->_fraction = part & 0xff;
+
+                if (whole > (0xffffffff - (part >> 8)) / group->_speed)
+                {
+                    group->_delta = 0xffffffff;
+                }
+                else
+                {
+                    group->_delta = whole * group->_speed + (part >> 8);
+                }
+            }
+        }
+    }
+#endif
 };
+
+typedef NeoPixelAnimatorBase<uint16_t> NeoPixelAnimator;
+typedef NeoPixelAnimatorBase<uint32_t> NeoPixelAnimator32;
+
+#include "internal/animations/NeoFramePacer.h"
@@ -28,6 +28,8 @@ License along with NeoPixel.  If not, see
 #include "buffers/LayoutMapCallback.h"
 #include "buffers/NeoShaderNop.h"
 #include "buffers/NeoShaderBase.h"
+#include "buffers/NeoWhiteExtractorShader.h"
+#include "buffers/NeoColorDepthShader.h"
 #include "buffers/NeoBufferContext.h"
 
 #include "buffers/NeoBuffer.h"
@@ -37,6 +37,8 @@ License along with NeoPixel.  If not, see
 
 #include "colors/HslColor.h"
 #include "colors/HsbColor.h"
+#include "colors/Hsl48Color.h"
+#include "colors/Hsb48Color.h"
 #include "colors/HtmlColor.h"
 
 #include "colors/RgbwColor.h"
@@ -49,6 +51,9 @@ License along with NeoPixel.  If not, see
 
 #include "colors/SegmentDigit.h"
 
+#include "colors/NeoGradient.h"
+#include "colors/NeoWhiteExtractor.h"
+
 #include "colors/NeoGamma.h"
 #include "colors/NeoGammaEquationMethod.h"
 #include "colors/NeoGammaCieLabEquationMethod.h"
@@ -56,3 +61,5 @@ License along with NeoPixel.  If not, see
 #include "colors/NeoGammaDynamicTableMethod.h"
 #include "colors/NeoGammaNullMethod.h"
 #include "colors/NeoGammaInvertMethod.h"
+
+#include "colors/NeoColorDepth.h"
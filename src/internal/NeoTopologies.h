@@ -32,8 +32,12 @@ License along with NeoPixel.  If not, see
 #include "topologies/RowMajorLayout.h"
 
 #include "topologies/NeoTopology.h"
+#include "topologies/NeoFixedTopology.h"
 #include "topologies/NeoRingTopology.h"
 #include "topologies/NeoTiles.h"
 #include "topologies/NeoMosaic.h"
+#include "topologies/NeoFixedTiles.h"
+#include "topologies/NeoFixedMosaic.h"
+#include "topologies/NeoCachedTopology.h"
 
 
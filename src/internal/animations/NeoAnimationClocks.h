@@ -0,0 +1,73 @@
+/*-------------------------------------------------------------------------
+NeoAnimationClocks provides time sources for animation support.
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+// ------------------------------------------------------------------------
+// NeoMicrosClock is the default time source for NeoPixelAnimatorBase,
+// using the Arduino micros()
+// ------------------------------------------------------------------------
+class NeoMicrosClock
+{
+public:
+    static uint32_t Micros()
+    {
+        return micros();
+    }
+};
+
+// ------------------------------------------------------------------------
+// NeoVirtualClock is a time source that only moves when told to, so 
+// animations can be stepped deterministically frame by frame and faster
+// (or slower) than real time, like when rendering a show off line
+//
+// example:
+//  NeoPixelAnimatorBase<uint16_t, NeoVirtualClock> animations(count);
+//  ...
+//  NeoVirtualClock::Advance(2500); // 400 Hz frame
+//  animations.UpdateAnimations();
+// ------------------------------------------------------------------------
+class NeoVirtualClock
+{
+public:
+    static uint32_t Micros()
+    {
+        return _now;
+    }
+
+    static void SetMicros(uint32_t now)
+    {
+        _now = now;
+    }
+
+    static void Advance(uint32_t elapsed)
+    {
+        _now += elapsed;
+    }
+
+private:
+    static uint32_t _now;
+};
@@ -0,0 +1,84 @@
+/*-------------------------------------------------------------------------
+NeoEase16 provides fixed point animation curve equations for animation support.
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+
+#include <Arduino.h>
+#include "NeoEase16.h"
+
+// sin(x * PI / 2) for x from 0.0 to 1.0 in 64 steps
+const uint16_t NeoEase16::_sinTable[] PROGMEM =
+{
+        0,  1608,  3216,  4821,  6424,  8022,  9616, 11204,
+    12785, 14359, 15924, 17479, 19024, 20557, 22078, 23586,
+    25079, 26557, 28020, 29465, 30893, 32302, 33692, 35061,
+    36409, 37736, 39039, 40319, 41575, 42806, 44011, 45189,
+    46340, 47464, 48558, 49624, 50659, 51664, 52638, 53580,
+    54490, 55367, 56211, 57021, 57797, 58537, 59243, 59913,
+    60546, 61144, 61704, 62227, 62713, 63161, 63571, 63943,
+    64276, 64570, 64826, 65042, 65219, 65357, 65456, 65515,
+    65535
+};
+
+// pow(2, 10 * (x - 1)) for x from 0.0 to 1.0 in 64 steps
+const uint16_t NeoEase16::_exponentialTable[] PROGMEM =
+{
+       64,    71,    79,    89,    99,   110,   123,   137,
+      152,   170,   189,   211,   235,   262,   292,   325,
+      362,   403,   450,   501,   558,   622,   693,   773,
+      861,   960,  1069,  1192,  1328,  1480,  1649,  1838,
+     2048,  2282,  2543,  2834,  3158,  3520,  3922,  4371,
+     4871,  5428,  6049,  6741,  7512,  8371,  9329, 10396,
+    11585, 12910, 14387, 16033, 17867, 19910, 22188, 24726,
+    27554, 30706, 34218, 38132, 42494, 47355, 52772, 58808,
+    65535
+};
+
+// pow(x, 1 / 0.45) for x from 0.0 to 1.0 in 64 steps
+const uint16_t NeoEase16::_gammaTable[] PROGMEM =
+{
+        0,     6,    30,    73,   138,   227,   340,   479,
+      645,   838,  1059,  1309,  1588,  1897,  2237,  2608,
+     3010,  3444,  3911,  4410,  4942,  5508,  6108,  6742,
+     7411,  8115,  8854,  9628, 10439, 11285, 12168, 13088,
+    14045, 15039, 16070, 17140, 18247, 19392, 20576, 21799,
+    23061, 24362, 25702, 27081, 28501, 29960, 31460, 33000,
+    34581, 36202, 37864, 39568, 41312, 43099, 44927, 46796,
+    48708, 50662, 52659, 54697, 56779, 58903, 61071, 63281,
+    65535
+};
+
+// CIE L*a*b* lightness for x from 0.0 to 1.0 in 64 steps
+const uint16_t NeoEase16::_gammaCieLabTable[] PROGMEM =
+{
+        0,   113,   227,   340,   453,   567,   686,   821,
+      972,  1141,  1328,  1535,  1762,  2010,  2281,  2575,
+     2894,  3237,  3607,  4004,  4429,  4883,  5367,  5882,
+     6429,  7009,  7623,  8272,  8956,  9677, 10436, 11234,
+    12071, 12948, 13868, 14830, 15835, 16885, 17980, 19121,
+    20310, 21547, 22833, 24170, 25558, 26997, 28490, 30037,
+    31639, 33297, 35012, 36785, 38616, 40507, 42460, 44473,
+    46550, 48690, 50895, 53166, 55503, 57907, 60380, 62922,
+    65535
+};
@@ -0,0 +1,300 @@
+/*-------------------------------------------------------------------------
+NeoEase16 provides fixed point animation curve equations for animation support.
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <Arduino.h>
+
+#if defined(NEOPIXEBUS_NO_STL)
+
+typedef uint16_t(*AnimEase16Function)(uint16_t unitValue);
+
+#else
+
+#undef max
+#undef min
+#include <functional>
+typedef std::function<uint16_t(uint16_t unitValue)> AnimEase16Function;
+
+#endif
+
+// ------------------------------------------------------------------------
+// NeoEase16 provides the same curves as NeoEase but in fixed point, 
+// where 0 - 65535 represents 0.0 - 1.0, like AnimationParam::progress16.
+// The polynomial curves use integer math, the circular curves an integer 
+// square root, and the sinusoidal, exponential and gamma curves 
+// interpolate small PROGMEM tables; so none of them need floating point.
+// The Center curves ease out to the center and then ease in from it.
+// ------------------------------------------------------------------------
+class NeoEase16
+{
+public:
+    static uint16_t Linear(uint16_t unitValue)
+    {
+        return unitValue;
+    }
+
+    static uint16_t QuadraticIn(uint16_t unitValue)
+    {
+        return _mul(unitValue, unitValue);
+    }
+
+    static uint16_t QuadraticOut(uint16_t unitValue)
+    {
+        return _out<QuadraticIn>(unitValue);
+    }
+
+    static uint16_t QuadraticInOut(uint16_t unitValue)
+    {
+        return _inOut<QuadraticIn>(unitValue);
+    }
+
+    static uint16_t QuadraticCenter(uint16_t unitValue)
+    {
+        return _center<QuadraticIn>(unitValue);
+    }
+
+    static uint16_t CubicIn(uint16_t unitValue)
+    {
+        return _mul(_mul(unitValue, unitValue), unitValue);
+    }
+
+    static uint16_t CubicOut(uint16_t unitValue)
+    {
+        return _out<CubicIn>(unitValue);
+    }
+
+    static uint16_t CubicInOut(uint16_t unitValue)
+    {
+        return _inOut<CubicIn>(unitValue);
+    }
+
+    static uint16_t CubicCenter(uint16_t unitValue)
+    {
+        return _center<CubicIn>(unitValue);
+    }
+
+    static uint16_t QuarticIn(uint16_t unitValue)
+    {
+        uint16_t square = _mul(unitValue, unitValue);
+        return _mul(square, square);
+    }
+
+    static uint16_t QuarticOut(uint16_t unitValue)
+    {
+        return _out<QuarticIn>(unitValue);
+    }
+
+    static uint16_t QuarticInOut(uint16_t unitValue)
+    {
+        return _inOut<QuarticIn>(unitValue);
+    }
+
+    static uint16_t QuarticCenter(uint16_t unitValue)
+    {
+        return _center<QuarticIn>(unitValue);
+    }
+
+    static uint16_t QuinticIn(uint16_t unitValue)
+    {
+        return _mul(QuarticIn(unitValue), unitValue);
+    }
+
+    static uint16_t QuinticOut(uint16_t unitValue)
+    {
+        return _out<QuinticIn>(unitValue);
+    }
+
+    static uint16_t QuinticInOut(uint16_t unitValue)
+    {
+        return _inOut<QuinticIn>(unitValue);
+    }
+
+    static uint16_t QuinticCenter(uint16_t unitValue)
+    {
+        return _center<QuinticIn>(unitValue);
+    }
+
+    static uint16_t SinusoidalIn(uint16_t unitValue)
+    {
+        // 1 - cos(x) == 1 - sin(1 - x)
+        return One - _interpolate(_sinTable, One - unitValue);
+    }
+
+    static uint16_t SinusoidalOut(uint16_t unitValue)
+    {
+        return _interpolate(_sinTable, unitValue);
+    }
+
+    static uint16_t SinusoidalInOut(uint16_t unitValue)
+    {
+        return _inOut<SinusoidalIn>(unitValue);
+    }
+
+    static uint16_t SinusoidalCenter(uint16_t unitValue)
+    {
+        return _center<SinusoidalIn>(unitValue);
+    }
+
+    static uint16_t ExponentialIn(uint16_t unitValue)
+    {
+        return _interpolate(_exponentialTable, unitValue);
+    }
+
+    static uint16_t ExponentialOut(uint16_t unitValue)
+    {
+        return _out<ExponentialIn>(unitValue);
+    }
+
+    static uint16_t ExponentialInOut(uint16_t unitValue)
+    {
+        return _inOut<ExponentialIn>(unitValue);
+    }
+
+    static uint16_t ExponentialCenter(uint16_t unitValue)
+    {
+        return _center<ExponentialIn>(unitValue);
+    }
+
+    static uint16_t CircularIn(uint16_t unitValue)
+    {
+        // 1 - sqrt(1 - x * x)
+        uint32_t square = static_cast<uint32_t>(unitValue) * unitValue;
+        return One - _sqrt(static_cast<uint32_t>(One) * One - square);
+    }
+
+    static uint16_t CircularOut(uint16_t unitValue)
+    {
+        return _out<CircularIn>(unitValue);
+    }
+
+    static uint16_t CircularInOut(uint16_t unitValue)
+    {
+        return _inOut<CircularIn>(unitValue);
+    }
+
+    static uint16_t CircularCenter(uint16_t unitValue)
+    {
+        return _center<CircularIn>(unitValue);
+    }
+
+    static uint16_t Gamma(uint16_t unitValue)
+    {
+        return _interpolate(_gammaTable, unitValue);
+    }
+
+    static uint16_t GammaCieLab(uint16_t unitValue)
+    {
+        return _interpolate(_gammaCieLabTable, unitValue);
+    }
+
+private:
+    static const uint16_t One = 0xffff;
+
+    static const uint16_t _sinTable[65];
+    static const uint16_t _exponentialTable[65];
+    static const uint16_t _gammaTable[65];
+    static const uint16_t _gammaCieLabTable[65];
+
+    // a * b where both and the result are 0 - 65535 for 0.0 - 1.0
+    static uint16_t _mul(uint16_t a, uint16_t b)
+    {
+        // rounded divide by 65535
+        uint32_t temp = static_cast<uint32_t>(a) * b + 0x8000;
+        return (temp + (temp >> 16)) >> 16;
+    }
+
+    static uint16_t _sqrt(uint32_t value)
+    {
+        uint32_t result = 0;
+        uint32_t bit = 1UL << 30;
+
+        while (bit > value)
+        {
+            bit >>= 2;
+        }
+
+        while (bit != 0)
+        {
+            if (value >= result + bit)
+            {
+                value -= result + bit;
+                result = (result >> 1) + bit;
+            }
+            else
+            {
+                result >>= 1;
+            }
+            bit >>= 2;
+        }
+        return result;
+    }
+
+    // linear interpolation of a 65 entry table covering 0.0 - 1.0
+    static uint16_t _interpolate(const uint16_t* table, uint16_t unitValue)
+    {
+        if (unitValue == One)
+        {
+            return pgm_read_word(table + 64);
+        }
+
+        uint8_t index = unitValue >> 10;
+        int32_t fraction = unitValue & 0x03ff;
+        int32_t first = pgm_read_word(table + index);
+        int32_t second = pgm_read_word(table + index + 1);
+
+        return first + (((second - first) * fraction) >> 10);
+    }
+
+    template <uint16_t(*T_IN)(uint16_t)> static uint16_t _out(uint16_t unitValue)
+    {
+        return One - T_IN(One - unitValue);
+    }
+
+    template <uint16_t(*T_IN)(uint16_t)> static uint16_t _inOut(uint16_t unitValue)
+    {
+        if (unitValue < 0x8000)
+        {
+            return T_IN(unitValue * 2) >> 1;
+        }
+        else
+        {
+            return One - (T_IN((One - unitValue) * 2) >> 1);
+        }
+    }
+
+    template <uint16_t(*T_IN)(uint16_t)> static uint16_t _center(uint16_t unitValue)
+    {
+        if (unitValue < 0x8000)
+        {
+            return _out<T_IN>(unitValue * 2) >> 1;
+        }
+        else
+        {
+            return 0x8000 + (T_IN((unitValue - 0x8000) * 2) >> 1);
+        }
+    }
+};
@@ -0,0 +1,122 @@
+/*-------------------------------------------------------------------------
+NeoFramePacer provides fixed frame rate pacing for animations.
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+// ------------------------------------------------------------------------
+// NeoFramePacer pairs NeoPixelAnimator::UpdateAnimations() with a bus's 
+// CanShow() so that frames are produced at a fixed rate.
+// Frame times are scheduled from the previous frame time rather than from
+// when the frame was actually produced, so a late frame does not shift 
+// all following frames; frames that are too late to be caught up are 
+// skipped and counted as missed.
+// The animator's clock is used, so it also paces virtual time.
+//
+// example:
+//  NeoFramePacer pacer(400);
+//  void loop()
+//  {
+//      if (pacer.Update(animations, strip))
+//      {
+//          strip.Show();
+//      }
+//  }
+// ------------------------------------------------------------------------
+class NeoFramePacer
+{
+public:
+    NeoFramePacer(uint16_t framesPerSecond) :
+        _nextFrame(0),
+        _missedFrames(0),
+        _isStarted(false)
+    {
+        setFrameRate(framesPerSecond);
+    }
+
+    // returns true when the animations were updated and the frame should 
+    // be shown
+    template <typename T_ANIMATOR, typename T_BUS> bool Update(T_ANIMATOR& animator, T_BUS& bus)
+    {
+        uint32_t now = T_ANIMATOR::Clock::Micros();
+
+        if (!_isStarted)
+        {
+            _nextFrame = now;
+            _isStarted = true;
+        }
+
+        int32_t late = static_cast<int32_t>(now - _nextFrame);
+
+        if (late < 0 || !bus.CanShow())
+        {
+            return false;
+        }
+
+        uint32_t missed = static_cast<uint32_t>(late) / _frameDuration;
+
+        _missedFrames += missed;
+        _nextFrame += (missed + 1) * _frameDuration;
+
+        animator.UpdateAnimations();
+        return true;
+    }
+
+    // restart the schedule, like after being paused
+    void Reset()
+    {
+        _isStarted = false;
+    }
+
+    void setFrameRate(uint16_t framesPerSecond)
+    {
+        if (framesPerSecond < 1)
+        {
+            framesPerSecond = 1;
+        }
+        _frameDuration = 1000000UL / framesPerSecond;
+    }
+
+    uint32_t getFrameDuration() const
+    {
+        return _frameDuration;
+    }
+
+    uint32_t getMissedFrames() const
+    {
+        return _missedFrames;
+    }
+
+    void resetMissedFrames()
+    {
+        _missedFrames = 0;
+    }
+
+private:
+    uint32_t _frameDuration; // microseconds
+    uint32_t _nextFrame; // clock microseconds
+    uint32_t _missedFrames;
+    bool _isStarted;
+};
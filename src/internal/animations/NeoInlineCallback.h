@@ -0,0 +1,179 @@
+/*-------------------------------------------------------------------------
+NeoInlineCallback provides a fixed capacity callable that never allocates.
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+#undef max
+#undef min
+#include <new>
+#include <type_traits>
+
+// ------------------------------------------------------------------------
+// NeoInlineCallback is a std::function like holder for a callable taking 
+// (const T_PARAM&), like a lambda with captures, that stores the callable 
+// within itself and so never uses the heap when constructed, copied or 
+// assigned.  
+// V_CAPTURE_SIZE is the number of bytes available for the captures, a
+// callable that does not fit will fail to compile rather than allocate.
+// ------------------------------------------------------------------------
+template <typename T_PARAM, size_t V_CAPTURE_SIZE> class NeoInlineCallback
+{
+public:
+    NeoInlineCallback() :
+        _ops(nullptr)
+    {
+    }
+
+    NeoInlineCallback(std::nullptr_t) :
+        _ops(nullptr)
+    {
+    }
+
+    // integral types are excluded so NULL still selects the nullptr_t constructor
+    template <typename T_CALLABLE, 
+        typename = typename std::enable_if<!std::is_same<typename std::decay<T_CALLABLE>::type, NeoInlineCallback>::value &&
+            !std::is_integral<typename std::decay<T_CALLABLE>::type>::value>::type> 
+    NeoInlineCallback(T_CALLABLE&& callable) :
+        _ops(nullptr)
+    {
+        _assign(static_cast<T_CALLABLE&&>(callable));
+    }
+
+    NeoInlineCallback(const NeoInlineCallback& other) :
+        _ops(nullptr)
+    {
+        _copyFrom(other);
+    }
+
+    ~NeoInlineCallback()
+    {
+        _reset();
+    }
+
+    NeoInlineCallback& operator=(const NeoInlineCallback& other)
+    {
+        if (this != &other)
+        {
+            _reset();
+            _copyFrom(other);
+        }
+        return *this;
+    }
+
+    NeoInlineCallback& operator=(std::nullptr_t)
+    {
+        _reset();
+        return *this;
+    }
+
+    void operator()(const T_PARAM& param) const
+    {
+        _ops->invoke(_storage, param);
+    }
+
+    explicit operator bool() const
+    {
+        return (_ops != nullptr);
+    }
+
+    bool operator==(std::nullptr_t) const
+    {
+        return (_ops == nullptr);
+    }
+
+    bool operator!=(std::nullptr_t) const
+    {
+        return (_ops != nullptr);
+    }
+
+private:
+    struct Ops
+    {
+        void (*invoke)(const void* storage, const T_PARAM& param);
+        void (*copy)(void* storage, const void* source);
+        void (*destroy)(void* storage);
+    };
+
+    template <typename T_CALLABLE> struct OpsFor
+    {
+        static void invoke(const void* storage, const T_PARAM& param)
+        {
+            (*static_cast<T_CALLABLE*>(const_cast<void*>(storage)))(param);
+        }
+
+        static void copy(void* storage, const void* source)
+        {
+            new (storage) T_CALLABLE(*static_cast<const T_CALLABLE*>(source));
+        }
+
+        static void destroy(void* storage)
+        {
+            static_cast<T_CALLABLE*>(storage)->~T_CALLABLE();
+        }
+
+        static const Ops ops;
+    };
+
+    alignas(void*) uint8_t _storage[V_CAPTURE_SIZE];
+    const Ops* _ops;
+
+    template <typename T_CALLABLE> void _assign(T_CALLABLE&& callable)
+    {
+        typedef typename std::decay<T_CALLABLE>::type Callable;
+
+        static_assert(sizeof(Callable) <= V_CAPTURE_SIZE, "callable captures do not fit within V_CAPTURE_SIZE");
+        static_assert(alignof(Callable) <= alignof(void*), "callable captures require greater alignment than supported");
+
+        new (_storage) Callable(static_cast<T_CALLABLE&&>(callable));
+        _ops = &OpsFor<Callable>::ops;
+    }
+
+    void _copyFrom(const NeoInlineCallback& other)
+    {
+        if (other._ops)
+        {
+            other._ops->copy(_storage, other._storage);
+            _ops = other._ops;
+        }
+    }
+
+    void _reset()
+    {
+        if (_ops)
+        {
+            _ops->destroy(_storage);
+            _ops = nullptr;
+        }
+    }
+};
+
+template <typename T_PARAM, size_t V_CAPTURE_SIZE> template <typename T_CALLABLE> 
+const typename NeoInlineCallback<T_PARAM, V_CAPTURE_SIZE>::Ops NeoInlineCallback<T_PARAM, V_CAPTURE_SIZE>::OpsFor<T_CALLABLE>::ops =
+{
+    &NeoInlineCallback<T_PARAM, V_CAPTURE_SIZE>::OpsFor<T_CALLABLE>::invoke,
+    &NeoInlineCallback<T_PARAM, V_CAPTURE_SIZE>::OpsFor<T_CALLABLE>::copy,
+    &NeoInlineCallback<T_PARAM, V_CAPTURE_SIZE>::OpsFor<T_CALLABLE>::destroy
+};
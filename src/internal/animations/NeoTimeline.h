@@ -0,0 +1,307 @@
+/*-------------------------------------------------------------------------
+NeoTimeline provides keyframed color tracks for animation support.
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+// the curve used between two keyframes, like NeoEase16::CubicIn
+typedef uint16_t(*NeoTimelineEase)(uint16_t unitValue);
+
+// ------------------------------------------------------------------------
+// NeoTimelineKeyframe is the state of a track at a position within the
+// timeline, each part is blended separately toward the next keyframe
+// position - 0 - 65535 representing the start to the end of the timeline
+// color - the color of the track at this position
+// ease - the curve used to blend toward the next keyframe, 
+//      NULL (or left out) for linear
+// brightness - 0 - 255 applied to the color, 255 (or left out) is the 
+//      color unchanged
+// offset - the number of pixels the range of the track is moved by, 
+//      negative moves toward the start of the strip, 0 (or left out) 
+//      leaves the range where it was set
+// ------------------------------------------------------------------------
+template <typename T_COLOR_OBJECT> struct NeoTimelineKeyframe
+{
+    NeoTimelineKeyframe(uint16_t position_,
+            const T_COLOR_OBJECT& color_,
+            NeoTimelineEase ease_ = NULL,
+            uint8_t brightness_ = 255,
+            int16_t offset_ = 0) :
+        position(position_),
+        color(color_),
+        ease(ease_),
+        brightness(brightness_),
+        offset(offset_)
+    {
+    }
+
+    uint16_t position;
+    T_COLOR_OBJECT color;
+    NeoTimelineEase ease;
+    uint8_t brightness;
+    int16_t offset;
+};
+
+// ------------------------------------------------------------------------
+// NeoTimelineBlend provides the blending at the precision of the color 
+// object, the 16 bit progress is kept for colors with 16 bit elements
+// ------------------------------------------------------------------------
+template <bool V_WIDE_ELEMENTS> class NeoTimelineBlend
+{
+public:
+    template <typename T_COLOR_OBJECT> static T_COLOR_OBJECT LinearBlend(const T_COLOR_OBJECT& left,
+        const T_COLOR_OBJECT& right,
+        uint16_t progress)
+    {
+        return T_COLOR_OBJECT::LinearBlend(left, right, static_cast<uint8_t>(progress >> 8));
+    }
+
+    template <typename T_COLOR_OBJECT> static T_COLOR_OBJECT Dim(const T_COLOR_OBJECT& color, 
+        uint16_t brightness)
+    {
+        return color.Dim(static_cast<uint8_t>(brightness >> 8));
+    }
+};
+
+template <> class NeoTimelineBlend<true>
+{
+public:
+    template <typename T_COLOR_OBJECT> static T_COLOR_OBJECT LinearBlend(const T_COLOR_OBJECT& left,
+        const T_COLOR_OBJECT& right,
+        uint16_t progress)
+    {
+        return T_COLOR_OBJECT::LinearBlend(left, right, progress);
+    }
+
+    template <typename T_COLOR_OBJECT> static T_COLOR_OBJECT Dim(const T_COLOR_OBJECT& color, 
+        uint16_t brightness)
+    {
+        return color.Dim(brightness);
+    }
+};
+
+// ------------------------------------------------------------------------
+// NeoTimeline renders a set of tracks, each a list of keyframes bound to 
+// a range of pixels, in a single pass per frame.  
+// The keyframes are not copied, they must remain valid while used by 
+// the timeline and must be sorted by position.
+// The progress used is the same as AnimationParam::progress16, so a 
+// single animation can drive the whole timeline, where the animation 
+// duration sets the length of the timeline.
+//
+// T_COLOR_OBJECT - the color object of the keyframes
+//
+// example, a red pulse that moves 20 pixels along the strip:
+//  const NeoTimelineKeyframe<RgbColor> pulse[] = {
+//      { 0, RgbColor(255, 0, 0), NeoEase16::CubicIn, 0, 0 },
+//      { 32768, RgbColor(255, 0, 0), NeoEase16::CubicOut, 255, 10 },
+//      { 65535, RgbColor(255, 0, 0), NULL, 0, 20 } };
+//
+//  timeline.SetTrack(0, 0, 10, pulse, countof(pulse));
+//  animations.StartAnimation(0, 5000, [](const AnimationParam& param)
+//      {
+//          timeline.Render(strip, param.progress16);
+//      });
+// ------------------------------------------------------------------------
+template <typename T_COLOR_OBJECT> class NeoTimeline
+{
+public:
+    typedef NeoTimelineKeyframe<T_COLOR_OBJECT> Keyframe;
+
+    NeoTimeline(uint16_t countTracks) :
+        _countTracks(countTracks)
+    {
+        _tracks = new Track[_countTracks];
+    }
+
+    ~NeoTimeline()
+    {
+        delete[] _tracks;
+    }
+
+    uint16_t TrackCount() const
+    {
+        return _countTracks;
+    }
+
+    // ------------------------------------------------------------------------
+    // SetTrack binds keyframes to a range of pixels
+    // indexTrack - the track to set
+    // indexPixel - the first pixel of the range, before the keyframe offset
+    // countPixels - the number of pixels in the range
+    // keyframes - the keyframes, sorted by position
+    // countKeyframes - the number of keyframes
+    // ------------------------------------------------------------------------
+    void SetTrack(uint16_t indexTrack,
+        uint16_t indexPixel,
+        uint16_t countPixels,
+        const Keyframe* keyframes,
+        uint16_t countKeyframes)
+    {
+        if (indexTrack >= _countTracks)
+        {
+            return;
+        }
+
+        Track* track = &_tracks[indexTrack];
+
+        track->indexPixel = indexPixel;
+        track->countPixels = countPixels;
+        track->keyframes = keyframes;
+        track->countKeyframes = (keyframes == NULL) ? 0 : countKeyframes;
+        track->cursor = 0;
+    }
+
+    void ClearTrack(uint16_t indexTrack)
+    {
+        SetTrack(indexTrack, 0, 0, NULL, 0);
+    }
+
+    // ------------------------------------------------------------------------
+    // Render sets the pixels of all tracks to their color at progress
+    // target - anything with SetPixelColor(index, color), like a 
+    //      NeoPixelBus or a NeoDib, that ignores indexes past its end
+    // progress - 0 - 65535 representing the start to the end of the timeline
+    // ------------------------------------------------------------------------
+    template <typename T_TARGET> void Render(T_TARGET& target, uint16_t progress)
+    {
+        const Track* tracksEnd = _tracks + _countTracks;
+
+        for (Track* track = _tracks; track < tracksEnd; track++)
+        {
+            if (track->countKeyframes == 0)
+            {
+                continue;
+            }
+
+            T_COLOR_OBJECT color;
+            int16_t offset;
+
+            _evaluate(track, progress, &color, &offset);
+
+            // pixels moved before the start of the strip are dropped
+            int32_t indexPixel = static_cast<int32_t>(track->indexPixel) + offset;
+            int32_t indexEnd = indexPixel + track->countPixels;
+
+            if (indexPixel < 0)
+            {
+                indexPixel = 0;
+            }
+            if (indexEnd > 0xffff)
+            {
+                indexEnd = 0xffff;
+            }
+
+            while (indexPixel < indexEnd)
+            {
+                target.SetPixelColor(indexPixel++, color);
+            }
+        }
+    }
+
+private:
+    typedef NeoTimelineBlend<(T_COLOR_OBJECT::Max > 255)> Blend;
+
+    struct Track
+    {
+        Track() :
+            indexPixel(0),
+            countPixels(0),
+            keyframes(NULL),
+            countKeyframes(0),
+            cursor(0)
+        {
+        }
+
+        uint16_t indexPixel;
+        uint16_t countPixels;
+        const Keyframe* keyframes;
+        uint16_t countKeyframes;
+        uint16_t cursor; // the keyframe last rendered from
+    };
+
+    uint16_t _countTracks;
+    Track* _tracks;
+
+    static void _evaluate(Track* track, 
+        uint16_t progress, 
+        T_COLOR_OBJECT* color, 
+        int16_t* offset)
+    {
+        const Keyframe* keyframes = track->keyframes;
+        uint16_t last = track->countKeyframes - 1;
+        uint16_t cursor = track->cursor;
+
+        // progress normally only moves forward, so the search continues 
+        // from the last keyframe used rather than starting over 
+        if (progress < keyframes[cursor].position)
+        {
+            cursor = 0;
+        }
+        while (cursor < last && progress >= keyframes[cursor + 1].position)
+        {
+            cursor++;
+        }
+        track->cursor = cursor;
+
+        const Keyframe* left = &keyframes[cursor];
+        uint16_t brightness;
+
+        if (cursor == last || progress <= left->position)
+        {
+            // before the first or after the last keyframe
+            *color = left->color;
+            *offset = left->offset;
+            brightness = left->brightness * 257;
+        }
+        else
+        {
+            const Keyframe* right = left + 1;
+            uint32_t span = right->position - left->position;
+            uint16_t unit = (static_cast<uint32_t>(progress - left->position) << 16) / span;
+
+            if (left->ease)
+            {
+                unit = left->ease(unit);
+            }
+
+            *color = Blend::LinearBlend(left->color, right->color, unit);
+
+            // brightness and offset blended with 15 bits of the unit, 
+            // rounded, so the products can't overflow 32 bits
+            int32_t half = unit >> 1;
+            int32_t brightnessDelta = (static_cast<int32_t>(right->brightness) - left->brightness) * 257;
+            brightness = left->brightness * 257 + ((brightnessDelta * half + 0x4000) >> 15);
+
+            int32_t offsetDelta = static_cast<int32_t>(right->offset) - left->offset;
+            *offset = left->offset + ((offsetDelta * half + 0x4000) >> 15);
+        }
+
+        if (brightness != 0xffff)
+        {
+            *color = Blend::Dim(*color, brightness);
+        }
+    }
+};
@@ -0,0 +1,61 @@
+/*-------------------------------------------------------------------------
+NeoColorDepthShader
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+// ------------------------------------------------------------------------
+// NeoColorDepthShader is a shader for NeoDib::Render that converts 
+// between 8 bit and 16 bit element colors, like rendering a 
+// NeoDib<Rgb48Color> to a NeoGrbFeature bus or a NeoDib<RgbColor> to a
+// NeoRgb48Feature bus.
+//
+// T_COLOR_OBJECT - the color object of the destination feature
+// T_CONVERTER - 
+//      NeoColorDepth (default, no gamma)
+//      NeoColorDepthGamma<one of the gamma methods>
+//
+// example:
+//  NeoColorDepthShader<RgbColor> shader;
+//  image48.Render<NeoGrbFeature>(strip, shader);
+// ------------------------------------------------------------------------
+template <typename T_COLOR_OBJECT, typename T_CONVERTER = NeoColorDepth> class NeoColorDepthShader : public NeoShaderBase
+{
+public:
+    NeoColorDepthShader() :
+        NeoShaderBase()
+    {
+    }
+
+    template <typename T_SRC_COLOR_OBJECT> T_COLOR_OBJECT Apply(uint16_t, const T_SRC_COLOR_OBJECT& color)
+    {
+        T_COLOR_OBJECT result;
+
+        _converter.Convert(&result, &color, 1);
+        return result;
+    }
+
+private:
+    T_CONVERTER _converter;
+};
@@ -133,7 +133,9 @@ public:
 
             for (uint16_t indexPixel = 0; indexPixel < countPixels; indexPixel++)
             {
-                T_COLOR_OBJECT color = shader.Apply(indexPixel, _pixels[indexPixel]);
+                // the shader may return the features color object 
+                // rather than T_COLOR_OBJECT, like NeoWhiteExtractorShader
+                typename T_COLOR_FEATURE::ColorObject color = shader.Apply(indexPixel, _pixels[indexPixel]);
                 T_COLOR_FEATURE::applyPixelColor(destBuffer.Pixels, destIndexPixel + indexPixel, color);
             }
 
@@ -0,0 +1,74 @@
+/*-------------------------------------------------------------------------
+NeoWhiteExtractorShader
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+// ------------------------------------------------------------------------
+// NeoWhiteExtractorShader is a shader for NeoDib<RgbColor>::Render that 
+// converts the RgbColor content into a color object with white elements,
+// so RGB content can drive RGBW, RGBWW and RGBWWW strips.
+//
+// T_COLOR_OBJECT - the color object of the destination feature
+//      RgbwColor, RgbwwColor, RgbwwwColor
+// T_EXTRACTOR - the white extraction method
+//      NeoWhiteExtractor (RgbwColor only)
+//      NeoDualWhiteExtractor (RgbwwColor only)
+//      NeoTripleWhiteExtractor (RgbwwwColor only)
+//
+// example:
+//  NeoWhiteExtractorShader<RgbwColor> shader(NeoWhiteExtractor(4000));
+//  image.Render<NeoGrbwFeature>(strip, shader);
+// ------------------------------------------------------------------------
+template <typename T_COLOR_OBJECT, typename T_EXTRACTOR = NeoWhiteExtractor> class NeoWhiteExtractorShader : public NeoShaderBase
+{
+public:
+    NeoWhiteExtractorShader(const T_EXTRACTOR& extractor = T_EXTRACTOR()) :
+        NeoShaderBase(),
+        _extractor(extractor)
+    {
+    }
+
+    T_COLOR_OBJECT Apply(uint16_t, const RgbColor& color)
+    {
+        T_COLOR_OBJECT result;
+
+        _extractor.Convert(color, &result);
+        return result;
+    }
+
+    void setExtractor(const T_EXTRACTOR& extractor)
+    {
+        _extractor = extractor;
+        Dirty(); // must call dirty when a property changes
+    }
+
+    const T_EXTRACTOR& getExtractor() const
+    {
+        return _extractor;
+    }
+
+private:
+    T_EXTRACTOR _extractor;
+};
@@ -0,0 +1,93 @@
+/*-------------------------------------------------------------------------
+Hsb48Color provides a fixed point color object that can be directly consumed by NeoPixelBus
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+
+#include <Arduino.h>
+#include "../NeoSettings.h"
+#include "RgbColorBase.h"
+#include "RgbColor.h"
+#include "Rgb48Color.h"
+#include "HsbColor.h"
+#include "Hsb48Color.h"
+
+void Hsb48Color::_RgbToHsb(uint16_t r, uint16_t g, uint16_t b, Hsb48Color* color)
+{
+    // specifically avoids float math
+    uint16_t max = (r > g && r > b) ? r : (g > b) ? g : b;
+    uint16_t min = (r < g && r < b) ? r : (g < b) ? g : b;
+
+    uint16_t d = max - min;
+
+    int32_t h = 0;
+    uint16_t v = max;
+    uint16_t s = (v == 0) ? 0 : (static_cast<uint32_t>(d) * Max / v);
+
+    if (d != 0)
+    {
+        // each sixth of the hue circle is 10923 (65536 / 6), 
+        // negative results wrap when stored into the uint16_t
+        if (r == max)
+        {
+            h = (static_cast<int32_t>(g) - b) * 10923 / d;
+        }
+        else if (g == max)
+        {
+            h = (static_cast<int32_t>(b) - r) * 10923 / d + 21845;
+        }
+        else
+        {
+            h = (static_cast<int32_t>(r) - g) * 10923 / d + 43691;
+        }
+    }
+
+    color->H = static_cast<uint16_t>(h);
+    color->S = s;
+    color->B = v;
+}
+
+Hsb48Color::Hsb48Color(const RgbColor& color)
+{
+    // expand colors to (0 - 65535)
+    _RgbToHsb(color.R * 257, color.G * 257, color.B * 257, this);
+}
+
+Hsb48Color::Hsb48Color(const Rgb48Color& color)
+{
+    _RgbToHsb(color.R, color.G, color.B, this);
+}
+
+Hsb48Color::Hsb48Color(const HsbColor& color)
+{
+    float h = color.H - static_cast<int32_t>(color.H);
+
+    if (h < 0.0f)
+    {
+        h += 1.0f;
+    }
+
+    H = static_cast<uint16_t>(static_cast<uint32_t>(h * 65536.0f));
+    S = static_cast<uint16_t>(color.S * Max);
+    B = static_cast<uint16_t>(color.B * Max);
+}
@@ -0,0 +1,82 @@
+/*-------------------------------------------------------------------------
+Hsb48Color provides a fixed point color object that can be directly consumed by NeoPixelBus
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+// ------------------------------------------------------------------------
+// Hsb48Color represents a color object that is represented by Hue, Saturation, Brightness
+// component values stored as fixed point 16 bit integers.  It is an 
+// alternative to HsbColor that converts to and from RgbColor and Rgb48Color
+// without any float math, which is important on platforms without a FPU.
+// ------------------------------------------------------------------------
+struct Hsb48Color
+{
+    // ------------------------------------------------------------------------
+    // Construct a Hsb48Color using H, S, B values (0 - 65535)
+    // H covers the full hue circle, so 65535 is just short of 0 and 
+    //   adding or subtracting from it will naturally wrap around
+    // ------------------------------------------------------------------------
+    Hsb48Color(uint16_t h, uint16_t s, uint16_t b) :
+        H(h), S(s), B(b)
+    {
+    };
+
+    // ------------------------------------------------------------------------
+    // Construct a Hsb48Color using RgbColor
+    // ------------------------------------------------------------------------
+    Hsb48Color(const RgbColor& color);
+
+    // ------------------------------------------------------------------------
+    // Construct a Hsb48Color using Rgb48Color
+    // ------------------------------------------------------------------------
+    Hsb48Color(const Rgb48Color& color);
+
+    // ------------------------------------------------------------------------
+    // explicitly Construct a Hsb48Color using HsbColor
+    // ------------------------------------------------------------------------
+    explicit Hsb48Color(const HsbColor& color);
+
+    // ------------------------------------------------------------------------
+    // Construct a Hsb48Color that will have its values set in latter operations
+    // CAUTION:  The H,S,B members are not initialized and may not be consistent
+    // ------------------------------------------------------------------------
+    Hsb48Color()
+    {
+    };
+
+    // ------------------------------------------------------------------------
+    // Hue, Saturation, Brightness color members (0 - 65535)
+    // ------------------------------------------------------------------------
+
+    uint16_t H;
+    uint16_t S;
+    uint16_t B;
+
+    const static uint16_t Max = 65535;
+
+private:
+    static void _RgbToHsb(uint16_t r, uint16_t g, uint16_t b, Hsb48Color* color);
+};
+
@@ -0,0 +1,82 @@
+/*-------------------------------------------------------------------------
+Hsl48Color provides a fixed point color object that can be directly consumed by NeoPixelBus
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+// ------------------------------------------------------------------------
+// Hsl48Color represents a color object that is represented by Hue, Saturation, Lightness
+// component values stored as fixed point 16 bit integers.  It is an 
+// alternative to HslColor that converts to and from RgbColor and Rgb48Color
+// without any float math, which is important on platforms without a FPU.
+// ------------------------------------------------------------------------
+struct Hsl48Color
+{
+    // ------------------------------------------------------------------------
+    // Construct a Hsl48Color using H, S, L values (0 - 65535)
+    // H covers the full hue circle, so 65535 is just short of 0 and 
+    //   adding or subtracting from it will naturally wrap around
+    // ------------------------------------------------------------------------
+    Hsl48Color(uint16_t h, uint16_t s, uint16_t l) :
+        H(h), S(s), L(l)
+    {
+    };
+
+    // ------------------------------------------------------------------------
+    // Construct a Hsl48Color using RgbColor
+    // ------------------------------------------------------------------------
+    Hsl48Color(const RgbColor& color);
+
+    // ------------------------------------------------------------------------
+    // Construct a Hsl48Color using Rgb48Color
+    // ------------------------------------------------------------------------
+    Hsl48Color(const Rgb48Color& color);
+
+    // ------------------------------------------------------------------------
+    // explicitly Construct a Hsl48Color using HslColor
+    // ------------------------------------------------------------------------
+    explicit Hsl48Color(const HslColor& color);
+
+    // ------------------------------------------------------------------------
+    // Construct a Hsl48Color that will have its values set in latter operations
+    // CAUTION:  The H,S,L members are not initialized and may not be consistent
+    // ------------------------------------------------------------------------
+    Hsl48Color()
+    {
+    };
+
+    // ------------------------------------------------------------------------
+    // Hue, Saturation, Lightness color members (0 - 65535)
+    // ------------------------------------------------------------------------
+
+    uint16_t H;
+    uint16_t S;
+    uint16_t L;
+
+    const static uint16_t Max = 65535;
+
+private:
+    static void _RgbToHsl(uint16_t r, uint16_t g, uint16_t b, Hsl48Color* color);
+};
+
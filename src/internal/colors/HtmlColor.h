@@ -43,21 +43,27 @@ struct HtmlColorPair
 
 // ------------------------------------------------------------------------
 // HtmlShortColorNames is a template class used for Parse and ToString
+// Pair() is ordered by name and PairByColor() is ordered by color
+// so both can be binary searched
 // ------------------------------------------------------------------------
 class HtmlShortColorNames
 {
 public:
     static const HtmlColorPair* Pair(uint8_t index);
+    static const HtmlColorPair* PairByColor(uint8_t index);
     static uint8_t Count();
 };
 
 // ------------------------------------------------------------------------
 // HtmlColorNames is a template class used for Parse and ToString
+// Pair() is ordered by name and PairByColor() is ordered by color
+// so both can be binary searched
 // ------------------------------------------------------------------------
 class HtmlColorNames
 {
 public:
     static const HtmlColorPair* Pair(uint8_t index);
+    static const HtmlColorPair* PairByColor(uint8_t index);
     static uint8_t Count();
 };
 
@@ -201,41 +207,51 @@ struct HtmlColor
                 // parse a standard name for the color
                 //
 
-                // the normal list is small enough a binary search isn't interesting,
-                for (uint8_t indexName = 0; indexName < T_HTMLCOLORNAMES::Count(); ++indexName)
-                {
-                    const HtmlColorPair* colorPair = T_HTMLCOLORNAMES::Pair(indexName);
-                    PGM_P searchName = reinterpret_cast<PGM_P>(pgm_read_ptr(&(colorPair->Name)));
-                    size_t str1Size = nameSize;
-                    const char* str1 = name;
-                    const char* str2P = searchName;
+                // collect the name in lower case up to the first non-alphanumeric
+                char nameLower[MAX_HTML_COLOR_NAME_LEN + 1];
+                size_t nameLen = 0;
 
-                    uint16_t result;
-
-                    while (str1Size > 0)
+                while (nameLen < nameSize && isalnum(name[nameLen]))
+                {
+                    if (nameLen == MAX_HTML_COLOR_NAME_LEN)
                     {
-                        char ch1 = tolower(*str1++);
-                        char ch2 = tolower(pgm_read_byte(str2P++));
-                        result = ch1 - ch2;
-                        if (result != 0 || ch2 == '\0')
-                        {
-                            if (ch2 == '\0' && !isalnum(ch1))
-                            {
-                                // the string continues but is not part of a
-                                // valid color name, 
-                                // ends in white space, deliminator, etc
-                                result = 0;
-                            }
-                            break;
-                        }
-                        result = -1; // have not reached the end of searchName;
-                        str1Size--;
+                        // too long to be any known name
+                        return 0;
                     }
+                    nameLower[nameLen] = tolower(name[nameLen]);
+                    nameLen++;
+                }
+
+                if (nameLen == 0 || nameLen == nameSize)
+                {
+                    // empty, or the name was not terminated within nameSize
+                    return 0;
+                }
+                nameLower[nameLen] = '\0';
+
+                // the pairs are sorted by name, so binary search them
+                uint8_t low = 0;
+                uint8_t high = T_HTMLCOLORNAMES::Count();
+
+                while (low < high)
+                {
+                    uint8_t mid = low + (high - low) / 2;
+                    const HtmlColorPair* colorPair = T_HTMLCOLORNAMES::Pair(mid);
+                    PGM_P searchName = reinterpret_cast<PGM_P>(pgm_read_ptr(&(colorPair->Name)));
+                    int result = strcmp_P(nameLower, searchName);
 
                     if (result == 0)
                     {
                         Color = pgm_read_dword(&colorPair->Color);
-                        return nameSize - str1Size;
+                        return nameLen;
+                    }
+                    else if (result < 0)
+                    {
+                        high = mid;
+                    }
+                    else
+                    {
+                        low = mid + 1;
                     }
                 }
             }
@@ -275,9 +291,28 @@ struct HtmlColor
     template <typename T_HTMLCOLORNAMES> size_t ToString(char* buf, size_t bufSize) const
     {
         // search for a color value/name pairs first
-        for (uint8_t indexName = 0; indexName < T_HTMLCOLORNAMES::Count(); ++indexName)
+        // the pairs are also sorted by color, so binary search them for 
+        // the first pair of the color, which is the first by name
+        uint8_t low = 0;
+        uint8_t high = T_HTMLCOLORNAMES::Count();
+
+        while (low < high)
+        {
+            uint8_t mid = low + (high - low) / 2;
+
+            if (pgm_read_dword(&(T_HTMLCOLORNAMES::PairByColor(mid)->Color)) < Color)
+            {
+                low = mid + 1;
+            }
+            else
+            {
+                high = mid;
+            }
+        }
+
+        if (low < T_HTMLCOLORNAMES::Count())
         {
-            const HtmlColorPair* colorPair = T_HTMLCOLORNAMES::Pair(indexName);
+            const HtmlColorPair* colorPair = T_HTMLCOLORNAMES::PairByColor(low);
             if (pgm_read_dword(&colorPair->Color) == Color)
             {
                 PGM_P name = (PGM_P)pgm_read_ptr(&colorPair->Name);
@@ -183,11 +183,31 @@ static const HtmlColorPair c_ColorNames[] PROGMEM = {
     { c_HtmlNameYellowGreen, 0x9acd32 },
 };
 
+// indexes into c_ColorNames ordered by color value, ties keep name order
+// NOTE: this must be regenerated if c_ColorNames is changed
+static const uint8_t c_ColorNamesByColor[] PROGMEM = {
+    7, 101, 21, 88, 9, 25, 54, 137, 22, 41, 38, 93, 82, 134, 2, 20,
+    96, 44, 76, 47, 125, 36, 37, 83, 91, 140, 121, 135, 35, 94, 60, 29,
+    13, 17, 87, 42, 43, 130, 104, 131, 132, 78, 79, 92, 65, 14, 3, 86,
+    118, 103, 53, 56, 129, 77, 10, 32, 28, 122, 34, 72, 90, 39, 109, 31,
+    146, 127, 11, 24, 26, 67, 55, 110, 80, 117, 45, 23, 89, 120, 27, 128,
+    95, 59, 114, 15, 136, 71, 73, 111, 138, 107, 52, 19, 49, 116, 12, 69,
+    63, 33, 141, 108, 68, 62, 0, 57, 4, 124, 142, 5, 144, 97, 50, 123,
+    1, 84, 70, 102, 119, 48, 85, 40, 106, 139, 58, 16, 30, 75, 105, 74,
+    115, 51, 113, 100, 99, 6, 98, 8, 112, 64, 126, 18, 66, 46, 133, 145,
+    81, 61, 143,
+};
+
 const HtmlColorPair* HtmlColorNames::Pair(uint8_t index)
 {
     return &c_ColorNames[index];
 }
 
+const HtmlColorPair* HtmlColorNames::PairByColor(uint8_t index)
+{
+    return &c_ColorNames[pgm_read_byte(&c_ColorNamesByColor[index])];
+}
+
 uint8_t HtmlColorNames::Count()
 {
     return countof(c_ColorNames);
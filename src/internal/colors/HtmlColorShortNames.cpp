@@ -53,12 +53,24 @@ static const HtmlColorPair c_ShortColorNames[] PROGMEM = {
     { c_HtmlNameYellow, 0xffff00 },
 };
 
+// indexes into c_ShortColorNames ordered by color value, ties keep name order
+// NOTE: this must be regenerated if c_ShortColorNames is changed
+static const uint8_t c_ShortColorNamesByColor[] PROGMEM = {
+    1, 8, 2, 5, 14, 6, 0, 7, 11, 9, 4, 13, 12, 3, 10, 16,
+    15,
+};
+
 
 const HtmlColorPair* HtmlShortColorNames::Pair(uint8_t index)
 {
     return &c_ShortColorNames[index];
 }
 
+const HtmlColorPair* HtmlShortColorNames::PairByColor(uint8_t index)
+{
+    return &c_ShortColorNames[pgm_read_byte(&c_ShortColorNamesByColor[index])];
+}
+
 uint8_t HtmlShortColorNames::Count()
 {
     return countof(c_ShortColorNames);
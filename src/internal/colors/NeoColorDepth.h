@@ -0,0 +1,233 @@
+/*-------------------------------------------------------------------------
+NeoColorDepth provides bulk conversion between 8 and 16 bit element colors
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+// ------------------------------------------------------------------------
+// NeoColorDepth converts whole arrays of colors, like the Pixels() of a 
+// NeoDib, between the 8 bit and 16 bit element color objects
+//      RgbColor <-> Rgb48Color
+//      RgbwColor <-> Rgbw64Color
+//      RgbwwColor <-> Rgbww80Color
+// The results match the converting constructors, but the colors are 
+// treated as a flat array of elements and processed a 32 bit word at a 
+// time where the platform supports it.
+//
+// examples:
+//  NeoColorDepth::Convert(image8.Pixels(), image16.Pixels(), image16.PixelCount());
+// ------------------------------------------------------------------------
+class NeoColorDepth
+{
+public:
+    static void Convert(Rgb48Color* dest, const RgbColor* src, uint16_t count)
+    {
+        _expand(&(dest->R), &(src->R), count * RgbColor::Count);
+    }
+
+    static void Convert(RgbColor* dest, const Rgb48Color* src, uint16_t count)
+    {
+        _reduce(&(dest->R), &(src->R), count * Rgb48Color::Count);
+    }
+
+    static void Convert(Rgbw64Color* dest, const RgbwColor* src, uint16_t count)
+    {
+        _expand(&(dest->R), &(src->R), count * RgbwColor::Count);
+    }
+
+    static void Convert(RgbwColor* dest, const Rgbw64Color* src, uint16_t count)
+    {
+        _reduce(&(dest->R), &(src->R), count * Rgbw64Color::Count);
+    }
+
+    static void Convert(Rgbww80Color* dest, const RgbwwColor* src, uint16_t count)
+    {
+        _expand(&(dest->R), &(src->R), count * RgbwwColor::Count);
+    }
+
+    static void Convert(RgbwwColor* dest, const Rgbww80Color* src, uint16_t count)
+    {
+        _reduce(&(dest->R), &(src->R), count * Rgbww80Color::Count);
+    }
+
+protected:
+    // the color objects must be nothing more than their elements
+    static_assert(sizeof(RgbColor) == 3 && sizeof(Rgb48Color) == 6, "RgbColor/Rgb48Color must be packed elements");
+    static_assert(sizeof(RgbwColor) == 4 && sizeof(Rgbw64Color) == 8, "RgbwColor/Rgbw64Color must be packed elements");
+    static_assert(sizeof(RgbwwColor) == 5 && sizeof(Rgbww80Color) == 10, "RgbwwColor/Rgbww80Color must be packed elements");
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    static const bool WordWide = false;
+#else
+    // 8 bit platforms are faster with single bytes
+    static const bool WordWide = (sizeof(size_t) >= 4);
+#endif
+
+    static void _expand(uint16_t* dest, const uint8_t* src, size_t countElements)
+    {
+        const uint8_t* srcEnd = src + countElements;
+
+        if (WordWide)
+        {
+            const uint8_t* srcEndWords = src + (countElements & ~static_cast<size_t>(3));
+
+            while (src < srcEndWords)
+            {
+                uint32_t word;
+                memcpy(&word, src, sizeof(word));
+                src += 4;
+
+                // spread the four bytes into four words, then 
+                // x * 257 is the same as duplicating the byte
+                uint32_t low = (word & 0x000000ff) | ((word & 0x0000ff00) << 8);
+                uint32_t high = ((word >> 16) & 0x000000ff) | ((word >> 8) & 0x00ff0000);
+
+                low |= low << 8;
+                high |= high << 8;
+
+                memcpy(dest, &low, sizeof(low));
+                memcpy(dest + 2, &high, sizeof(high));
+                dest += 4;
+            }
+        }
+
+        while (src < srcEnd)
+        {
+            *dest++ = static_cast<uint16_t>(*src++) * 257;
+        }
+    }
+
+    static void _reduce(uint8_t* dest, const uint16_t* src, size_t countElements)
+    {
+        const uint16_t* srcEnd = src + countElements;
+
+        if (WordWide)
+        {
+            const uint16_t* srcEndWords = src + (countElements & ~static_cast<size_t>(3));
+
+            while (src < srcEndWords)
+            {
+                uint32_t low;
+                uint32_t high;
+                memcpy(&low, src, sizeof(low));
+                memcpy(&high, src + 2, sizeof(high));
+                src += 4;
+
+                // gather the high byte of each of the four words
+                uint32_t word = ((low >> 8) & 0x000000ff) |
+                    ((low >> 16) & 0x0000ff00) |
+                    ((high << 8) & 0x00ff0000) |
+                    (high & 0xff000000);
+
+                memcpy(dest, &word, sizeof(word));
+                dest += 4;
+            }
+        }
+
+        while (src < srcEnd)
+        {
+            *dest++ = *src++ >> 8;
+        }
+    }
+};
+
+// ------------------------------------------------------------------------
+// NeoColorDepthGamma converts the same as NeoColorDepth while also 
+// applying gamma correction in the same pass.  The gamma is precomputed 
+// into tables at construction (768 bytes), so each element is a single 
+// lookup regardless of the gamma method.
+//
+// T_GAMMA - 
+//    NeoGammaEquationMethod 
+//    NeoGammaCieLabEquationMethod
+//    NeoGammaTableMethod
+//    NeoGammaInvert<one of the above>
+// ------------------------------------------------------------------------
+template<typename T_GAMMA> class NeoColorDepthGamma
+{
+public:
+    NeoColorDepthGamma()
+    {
+        for (uint16_t value = 0; value < 256; value++)
+        {
+            // expanded first so the 16 bit gamma curve is used
+            _expandTable[value] = T_GAMMA::Correct(static_cast<uint16_t>(value * 257));
+            _reduceTable[value] = T_GAMMA::Correct(static_cast<uint8_t>(value));
+        }
+    }
+
+    void Convert(Rgb48Color* dest, const RgbColor* src, uint16_t count) const
+    {
+        _expand(&(dest->R), &(src->R), count * RgbColor::Count);
+    }
+
+    void Convert(RgbColor* dest, const Rgb48Color* src, uint16_t count) const
+    {
+        _reduce(&(dest->R), &(src->R), count * Rgb48Color::Count);
+    }
+
+    void Convert(Rgbw64Color* dest, const RgbwColor* src, uint16_t count) const
+    {
+        _expand(&(dest->R), &(src->R), count * RgbwColor::Count);
+    }
+
+    void Convert(RgbwColor* dest, const Rgbw64Color* src, uint16_t count) const
+    {
+        _reduce(&(dest->R), &(src->R), count * Rgbw64Color::Count);
+    }
+
+    void Convert(Rgbww80Color* dest, const RgbwwColor* src, uint16_t count) const
+    {
+        _expand(&(dest->R), &(src->R), count * RgbwwColor::Count);
+    }
+
+    void Convert(RgbwwColor* dest, const Rgbww80Color* src, uint16_t count) const
+    {
+        _reduce(&(dest->R), &(src->R), count * Rgbww80Color::Count);
+    }
+
+protected:
+    uint16_t _expandTable[256];
+    uint8_t _reduceTable[256];
+
+    void _expand(uint16_t* dest, const uint8_t* src, size_t countElements) const
+    {
+        const uint8_t* srcEnd = src + countElements;
+
+        while (src < srcEnd)
+        {
+            *dest++ = _expandTable[*src++];
+        }
+    }
+
+    void _reduce(uint8_t* dest, const uint16_t* src, size_t countElements) const
+    {
+        const uint16_t* srcEnd = src + countElements;
+
+        while (src < srcEnd)
+        {
+            *dest++ = _reduceTable[*src++ >> 8];
+        }
+    }
+};
@@ -0,0 +1,144 @@
+/*-------------------------------------------------------------------------
+NeoGradient provides span level gradient fills for NeoPixelBus
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+// ------------------------------------------------------------------------
+// NeoGradient fills a span of pixels with a linear gradient between colors.
+// Rather than calling LinearBlend per pixel, each element is stepped 
+// incrementally in fixed point, so each pixel only costs an add and a 
+// shift per element.
+// 
+// T_BUFFER - any object that exposes SetPixelColor(uint16_t, T_COLOR)
+//      NeoPixelBus, NeoPixelBusLg, NeoDib, NeoBuffer<NeoBufferMethod>
+// T_COLOR - one of the color objects with read write operator[]
+//      RgbColor, RgbwColor, RgbwwColor, RgbwwwColor
+//      Rgb48Color, Rgbw64Color, Rgbww80Color
+// ------------------------------------------------------------------------
+class NeoGradient
+{
+public:
+    // ------------------------------------------------------------------------
+    // Fill a span of pixels with a gradient from one color to another
+    // buffer - the pixels to fill
+    // first - the first pixel index of the span
+    // count - the number of pixels in the span
+    // from - the color of the first pixel
+    // to - the color of the last pixel
+    // ------------------------------------------------------------------------
+    template <typename T_BUFFER, typename T_COLOR> static void Fill(T_BUFFER& buffer,
+        uint16_t first,
+        uint16_t count,
+        const T_COLOR& from,
+        const T_COLOR& to)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        if (count == 1)
+        {
+            buffer.SetPixelColor(first, from);
+            return;
+        }
+
+        // element fixed point, leaves the top bit for the sign of the step
+        const uint8_t FractionBits = (sizeof(T_COLOR::Max) == 1) ? 23 : 15;
+        const int32_t One = static_cast<int32_t>(1) << FractionBits;
+
+        uint16_t steps = count - 1;
+        uint32_t accum[T_COLOR::Count];
+        int32_t step[T_COLOR::Count];
+
+        for (size_t elem = 0; elem < T_COLOR::Count; elem++)
+        {
+            // start at half to round rather than truncate
+            accum[elem] = static_cast<uint32_t>(from[elem]) * One + (One / 2);
+            step[elem] = (static_cast<int32_t>(to[elem]) - static_cast<int32_t>(from[elem])) * One / steps;
+        }
+
+        T_COLOR color;
+
+        for (uint16_t index = 0; index < steps; index++)
+        {
+            for (size_t elem = 0; elem < T_COLOR::Count; elem++)
+            {
+                color[elem] = accum[elem] >> FractionBits;
+                accum[elem] += step[elem];
+            }
+            buffer.SetPixelColor(first + index, color);
+        }
+
+        // end exactly on the target color, avoiding any accumulated error
+        buffer.SetPixelColor(first + steps, to);
+    }
+
+    // ------------------------------------------------------------------------
+    // Fill a span of pixels with a gradient that passes through all the
+    // colors of a palette, each evenly spaced along the span
+    // buffer - the pixels to fill
+    // first - the first pixel index of the span
+    // count - the number of pixels in the span
+    // palette - the array of colors (stops) to pass through in order
+    // countPalette - the number of colors in the palette
+    // ------------------------------------------------------------------------
+    template <typename T_BUFFER, typename T_COLOR> static void FillPalette(T_BUFFER& buffer,
+        uint16_t first,
+        uint16_t count,
+        const T_COLOR* palette,
+        uint16_t countPalette)
+    {
+        if (count == 0 || countPalette == 0)
+        {
+            return;
+        }
+
+        if (countPalette == 1)
+        {
+            Fill(buffer, first, count, palette[0], palette[0]);
+            return;
+        }
+
+        uint16_t segments = countPalette - 1;
+        uint16_t last = count - 1;
+        uint16_t segmentFirst = 0;
+
+        for (uint16_t segment = 0; segment < segments; segment++)
+        {
+            uint16_t segmentLast = static_cast<uint32_t>(last) * (segment + 1) / segments;
+
+            // segments share their end pixels, the next segment will 
+            // overwrite it with the same stop color
+            Fill(buffer, 
+                first + segmentFirst, 
+                segmentLast - segmentFirst + 1, 
+                palette[segment], 
+                palette[segment + 1]);
+
+            segmentFirst = segmentLast;
+        }
+    }
+};
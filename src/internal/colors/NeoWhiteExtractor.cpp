@@ -0,0 +1,151 @@
+/*-------------------------------------------------------------------------
+NeoWhiteExtractor provides conversion of RGB colors to colors with white channels
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+
+#include <Arduino.h>
+#include "../NeoSettings.h"
+#include "RgbColorBase.h"
+#include "RgbColor.h"
+#include "RgbwColor.h"
+#include "RgbwwColor.h"
+#include "RgbwwwColor.h"
+#include "NeoWhiteExtractor.h"
+
+static uint8_t clampElement(float value)
+{
+    if (value < 0.0f)
+    {
+        return 0;
+    }
+    else if (value > 255.0f)
+    {
+        return 255;
+    }
+    return static_cast<uint8_t>(value);
+}
+
+NeoWhiteExtractor::NeoWhiteExtractor(uint16_t kelvin)
+{
+    // approximation of the black body color for a color temperature
+    // by Tanner Helland, only called once so float math is acceptable
+    if (kelvin < 1000)
+    {
+        kelvin = 1000;
+    }
+    else if (kelvin > 40000)
+    {
+        kelvin = 40000;
+    }
+
+    float temp = kelvin / 100.0f;
+    float r;
+    float g;
+    float b;
+
+    if (temp <= 66.0f)
+    {
+        r = 255.0f;
+        g = 99.4708025861f * log(temp) - 161.1195681661f;
+    }
+    else
+    {
+        r = 329.698727446f * pow(temp - 60.0f, -0.1332047592f);
+        g = 288.1221695283f * pow(temp - 60.0f, -0.0755148492f);
+    }
+
+    if (temp >= 66.0f)
+    {
+        b = 255.0f;
+    }
+    else if (temp <= 19.0f)
+    {
+        b = 0.0f;
+    }
+    else
+    {
+        b = 138.5177312231f * log(temp - 10.0f) - 305.0447927307f;
+    }
+
+    _setWhite(RgbColor(clampElement(r), clampElement(g), clampElement(b)));
+}
+
+NeoWhiteExtractor::NeoWhiteExtractor(const RgbColor& white)
+{
+    _setWhite(white);
+}
+
+void NeoWhiteExtractor::_setWhite(const RgbColor& white)
+{
+    for (uint8_t elem = 0; elem < 3; elem++)
+    {
+        _white[elem] = white[elem];
+        // rounded down so the white never removes more than the element has,
+        // zero means the white LED doesn't contribute to this element
+        _scale[elem] = (_white[elem] == 0) ? 0 : (static_cast<uint16_t>(255) << 8) / _white[elem];
+    }
+}
+
+uint8_t NeoWhiteExtractor::Extract(RgbColor* color) const
+{
+    // specifically avoids float math
+    uint16_t white = 255;
+
+    // the white is limited by the element that has the least of what the 
+    // white LED would add to it
+    for (uint8_t elem = 0; elem < 3; elem++)
+    {
+        if (_scale[elem])
+        {
+            uint16_t limit = (static_cast<uint32_t>((*color)[elem]) * _scale[elem]) >> 8;
+            if (limit < white)
+            {
+                white = limit;
+            }
+        }
+    }
+
+    if (white)
+    {
+        for (uint8_t elem = 0; elem < 3; elem++)
+        {
+            // white * _white[elem] / 255 rounded, without a divide
+            uint16_t temp = white * _white[elem] + 128;
+            uint8_t remove = (temp + (temp >> 8)) >> 8;
+            uint8_t& value = (*color)[elem];
+
+            value = (value > remove) ? value - remove : 0;
+        }
+    }
+
+    return white;
+}
+
+void NeoWhiteExtractor::Convert(const RgbColor& color, RgbwColor* result) const
+{
+    RgbColor remaining = color;
+    uint8_t white = Extract(&remaining);
+
+    *result = RgbwColor(remaining.R, remaining.G, remaining.B, white);
+}
@@ -0,0 +1,195 @@
+/*-------------------------------------------------------------------------
+NeoWhiteExtractor provides conversion of RGB colors to colors with white channels
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+// ------------------------------------------------------------------------
+// NeoWhiteExtractor converts RgbColor into RgbwColor by 
+// moving as much of the color as possible onto the white LED, using
+// the color temperature of the white LED to know how much of each of
+// the red, green and blue elements it can replace.
+// All conversions use integer math, the color temperature is only
+// calculated once at construction.
+// 
+// examples:
+//  NeoWhiteExtractor extractor(4000); // natural white LEDs
+//  RgbwColor color;
+//  extractor.Convert(RgbColor(255, 200, 150), &color);
+// ------------------------------------------------------------------------
+class NeoWhiteExtractor
+{
+public:
+    // ------------------------------------------------------------------------
+    // Construct a NeoWhiteExtractor for a white LED of the given 
+    // color temperature
+    // kelvin - (1000 - 40000) color temperature of the white LED, 
+    //      commonly 2700 (warm), 4000 (natural), 6500 (cool/daylight)
+    // ------------------------------------------------------------------------
+    NeoWhiteExtractor(uint16_t kelvin = 6500);
+
+    // ------------------------------------------------------------------------
+    // Construct a NeoWhiteExtractor for a white LED with a measured 
+    // equivalent RgbColor at full brightness
+    // ------------------------------------------------------------------------
+    NeoWhiteExtractor(const RgbColor& white);
+
+    // ------------------------------------------------------------------------
+    // Extract will remove the white from the color and return the 
+    // amount of white (0-255) that was removed
+    // ------------------------------------------------------------------------
+    uint8_t Extract(RgbColor* color) const;
+
+    // ------------------------------------------------------------------------
+    // Convert the color to a RgbwColor
+    // for RgbwwColor use NeoDualWhiteExtractor and for RgbwwwColor use
+    // NeoTripleWhiteExtractor, as each white LED has its own temperature
+    // ------------------------------------------------------------------------
+    void Convert(const RgbColor& color, RgbwColor* result) const;
+
+    // ------------------------------------------------------------------------
+    // Convert a whole array of colors, like the Pixels() of a NeoDib
+    // dest - the converted colors
+    // src - the colors to convert
+    // count - the number of colors to convert
+    // ------------------------------------------------------------------------
+    template <typename T_COLOR_OBJECT> void Convert(T_COLOR_OBJECT* dest, 
+        const RgbColor* src, 
+        uint16_t count) const
+    {
+        const RgbColor* srcEnd = src + count;
+
+        while (src < srcEnd)
+        {
+            Convert(*src++, dest++);
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // the equivalent RgbColor of the white LED at full brightness
+    // ------------------------------------------------------------------------
+    RgbColor getWhite() const
+    {
+        return RgbColor(_white[0], _white[1], _white[2]);
+    }
+
+private:
+    uint8_t _white[3]; // white LED equivalent R, G, B
+    uint16_t _scale[3]; // 255 / white element, in 8.8 fixed point
+
+    void _setWhite(const RgbColor& white);
+};
+
+// ------------------------------------------------------------------------
+// NeoDualWhiteExtractor converts RgbColor into RgbwwColor where the
+// two white LEDs are different color temperatures.  The warm white is
+// extracted first and then the cool white from what remains.
+// ------------------------------------------------------------------------
+class NeoDualWhiteExtractor
+{
+public:
+    // ------------------------------------------------------------------------
+    // Construct a NeoDualWhiteExtractor for a warm (WW) and a cool (CW) 
+    // white LED of the given color temperatures
+    // ------------------------------------------------------------------------
+    NeoDualWhiteExtractor(uint16_t warmKelvin = 2700, uint16_t coolKelvin = 6500) :
+        _warm(warmKelvin),
+        _cool(coolKelvin)
+    {
+    }
+
+    void Convert(const RgbColor& color, RgbwwColor* result) const
+    {
+        RgbColor remaining = color;
+        uint8_t warm = _warm.Extract(&remaining);
+        uint8_t cool = _cool.Extract(&remaining);
+
+        *result = RgbwwColor(remaining.R, remaining.G, remaining.B, warm, cool);
+    }
+
+    template <typename T_COLOR_OBJECT> void Convert(T_COLOR_OBJECT* dest,
+        const RgbColor* src,
+        uint16_t count) const
+    {
+        const RgbColor* srcEnd = src + count;
+
+        while (src < srcEnd)
+        {
+            Convert(*src++, dest++);
+        }
+    }
+
+private:
+    NeoWhiteExtractor _warm;
+    NeoWhiteExtractor _cool;
+};
+
+// ------------------------------------------------------------------------
+// NeoTripleWhiteExtractor converts RgbColor into RgbwwwColor where the
+// three white LEDs are different color temperatures.  Each white is 
+// extracted in turn, W1 first, from what remains after the previous ones.
+// ------------------------------------------------------------------------
+class NeoTripleWhiteExtractor
+{
+public:
+    // ------------------------------------------------------------------------
+    // Construct a NeoTripleWhiteExtractor for the W1, W2 and W3 white LEDs 
+    // of the given color temperatures
+    // ------------------------------------------------------------------------
+    NeoTripleWhiteExtractor(uint16_t w1Kelvin = 2700, 
+            uint16_t w2Kelvin = 4000, 
+            uint16_t w3Kelvin = 6500) :
+        _w1(w1Kelvin),
+        _w2(w2Kelvin),
+        _w3(w3Kelvin)
+    {
+    }
+
+    void Convert(const RgbColor& color, RgbwwwColor* result) const
+    {
+        RgbColor remaining = color;
+        uint8_t w1 = _w1.Extract(&remaining);
+        uint8_t w2 = _w2.Extract(&remaining);
+        uint8_t w3 = _w3.Extract(&remaining);
+
+        *result = RgbwwwColor(remaining.R, remaining.G, remaining.B, w1, w2, w3);
+    }
+
+    template <typename T_COLOR_OBJECT> void Convert(T_COLOR_OBJECT* dest,
+        const RgbColor* src,
+        uint16_t count) const
+    {
+        const RgbColor* srcEnd = src + count;
+
+        while (src < srcEnd)
+        {
+            Convert(*src++, dest++);
+        }
+    }
+
+private:
+    NeoWhiteExtractor _w1;
+    NeoWhiteExtractor _w2;
+    NeoWhiteExtractor _w3;
+};
@@ -31,6 +31,8 @@ License along with NeoPixel.  If not, see
 #include "Rgb48Color.h"
 #include "HslColor.h"
 #include "HsbColor.h"
+#include "Hsl48Color.h"
+#include "Hsb48Color.h"
 #include "HtmlColor.h"
 
 #include "RgbwColor.h"
@@ -69,6 +71,32 @@ Rgb48Color::Rgb48Color(const HsbColor& color)
     B = static_cast<uint16_t>(b * Max);
 }
 
+Rgb48Color::Rgb48Color(const Hsl48Color& color)
+{
+    uint16_t r;
+    uint16_t g;
+    uint16_t b;
+
+    _HslToRgb(color, &r, &g, &b);
+
+    R = r;
+    G = g;
+    B = b;
+}
+
+Rgb48Color::Rgb48Color(const Hsb48Color& color)
+{
+    uint16_t r;
+    uint16_t g;
+    uint16_t b;
+
+    _HsbToRgb(color, &r, &g, &b);
+
+    R = r;
+    G = g;
+    B = b;
+}
+
 uint16_t Rgb48Color::CalculateBrightness() const
 {
     return static_cast<uint16_t>((static_cast<uint32_t>(R) + static_cast<uint32_t>(G) + static_cast<uint32_t>(B)) / 3);
@@ -159,6 +187,16 @@ Rgb48Color Rgb48Color::LinearBlend(const Rgb48Color& left, const Rgb48Color& rig
         left.B + (((static_cast<int64_t>(right.B) - left.B) * static_cast<int64_t>(progress) + 1) >> 8));
 }
 
+Rgb48Color Rgb48Color::LinearBlend(const Rgb48Color& left, const Rgb48Color& right, uint16_t progress)
+{
+    // scaled so 65535 is a full step to right
+    int64_t p = static_cast<int64_t>(progress) + (progress >> 15);
+
+    return Rgb48Color(left.R + (((static_cast<int64_t>(right.R) - left.R) * p) >> 16),
+        left.G + (((static_cast<int64_t>(right.G) - left.G) * p) >> 16),
+        left.B + (((static_cast<int64_t>(right.B) - left.B) * p) >> 16));
+}
+
 Rgb48Color Rgb48Color::BilinearBlend(const Rgb48Color& c00, 
     const Rgb48Color& c01, 
     const Rgb48Color& c10, 
@@ -96,6 +96,16 @@ struct Rgb48Color : RgbColorBase
     // ------------------------------------------------------------------------
     Rgb48Color(const HsbColor& color);
 
+    // ------------------------------------------------------------------------
+    // Construct a Rgb48Color using Hsl48Color
+    // ------------------------------------------------------------------------
+    Rgb48Color(const Hsl48Color& color);
+
+    // ------------------------------------------------------------------------
+    // Construct a Rgb48Color using Hsb48Color
+    // ------------------------------------------------------------------------
+    Rgb48Color(const Hsb48Color& color);
+
     // ------------------------------------------------------------------------
     // Construct a Rgb48Color that will have its values set in latter operations
     // CAUTION:  The R,G,B members are not initialized and may not be consistent
@@ -251,6 +261,10 @@ struct Rgb48Color : RgbColorBase
     //     and a value between will blend the color weighted linearly between them
     // ------------------------------------------------------------------------
     static Rgb48Color LinearBlend(const Rgb48Color& left, const Rgb48Color& right, uint8_t progress);
+    // progress - (0 - 65535) value where 0 will return left and 65535 will return right
+    //     and a value between will blend the color weighted linearly between them
+    // ------------------------------------------------------------------------
+    static Rgb48Color LinearBlend(const Rgb48Color& left, const Rgb48Color& right, uint16_t progress);
 
     // ------------------------------------------------------------------------
     // BilinearBlend between four colors by the amount defined by 2d variable
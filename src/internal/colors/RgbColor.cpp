@@ -32,6 +32,8 @@ License along with NeoPixel.  If not, see
 #include "Rgb48Color.h"
 #include "HslColor.h"
 #include "HsbColor.h"
+#include "Hsl48Color.h"
+#include "Hsb48Color.h"
 #include "HtmlColor.h"
 
 #include "RgbwColor.h"
@@ -126,6 +128,32 @@ RgbColor::RgbColor(const HsbColor& color)
     B = static_cast<uint8_t>(b * Max);
 }
 
+RgbColor::RgbColor(const Hsl48Color& color)
+{
+    uint16_t r;
+    uint16_t g;
+    uint16_t b;
+
+    _HslToRgb(color, &r, &g, &b);
+
+    R = r >> 8;
+    G = g >> 8;
+    B = b >> 8;
+}
+
+RgbColor::RgbColor(const Hsb48Color& color)
+{
+    uint16_t r;
+    uint16_t g;
+    uint16_t b;
+
+    _HsbToRgb(color, &r, &g, &b);
+
+    R = r >> 8;
+    G = g >> 8;
+    B = b >> 8;
+}
+
 uint8_t RgbColor::CalculateBrightness() const
 {
     return static_cast<uint8_t>((static_cast<uint16_t>(R) + static_cast<uint16_t>(G) + static_cast<uint16_t>(B)) / 3);
@@ -109,6 +109,16 @@ struct RgbColor : RgbColorBase
     // ------------------------------------------------------------------------
     RgbColor(const HsbColor& color);
 
+    // ------------------------------------------------------------------------
+    // Construct a RgbColor using Hsl48Color
+    // ------------------------------------------------------------------------
+    RgbColor(const Hsl48Color& color);
+
+    // ------------------------------------------------------------------------
+    // Construct a RgbColor using Hsb48Color
+    // ------------------------------------------------------------------------
+    RgbColor(const Hsb48Color& color);
+
 
     // ------------------------------------------------------------------------
     // Construct a RgbColor that will have its values set in latter operations
@@ -31,6 +31,8 @@ License along with NeoPixel.  If not, see
 #include "Rgb48Color.h"
 #include "HslColor.h"
 #include "HsbColor.h"
+#include "Hsl48Color.h"
+#include "Hsb48Color.h"
 #include "HtmlColor.h"
 
 float RgbColorBase::_CalcColor(float p, float q, float t)
@@ -133,4 +135,118 @@ void RgbColorBase::_HsbToRgb(const HsbColor& color, float* r, float* g, float* b
             break;
         }
     }
-}
\ No newline at end of file
+}
+
+uint16_t RgbColorBase::_CalcColor(uint16_t p, uint16_t q, uint32_t t)
+{
+    // t is hue in sixths of the circle scaled by 65536, so every 
+    // boundary is exact where thirds of 65536 would not be
+    // q is always greater or equal to p
+    const uint32_t OneSixth = 65536;
+    const uint32_t OneHalf = 65536 * 3;
+    const uint32_t TwoThirds = 65536 * 4;
+
+    if (t < OneSixth)
+    {
+        return p + ((static_cast<uint32_t>(q - p) * t) >> 16);
+    }
+
+    if (t < OneHalf)
+    {
+        return q;
+    }
+
+    if (t < TwoThirds)
+    {
+        return p + ((static_cast<uint32_t>(q - p) * (TwoThirds - t)) >> 16);
+    }
+
+    return p;
+}
+
+void RgbColorBase::_HslToRgb(const Hsl48Color& color, uint16_t* r, uint16_t* g, uint16_t* b)
+{
+    uint16_t h = color.H;
+    uint16_t s = color.S;
+    uint16_t l = color.L;
+
+    if (s == 0 || l == 0)
+    {
+        *r = *g = *b = l; // achromatic or black
+    }
+    else
+    {
+        // hue in sixths of the circle scaled by 65536
+        const uint32_t Circle = 65536 * 6;
+        const uint32_t OneThird = 65536 * 2;
+        uint32_t h6 = static_cast<uint32_t>(h) * 6;
+        uint32_t hr = (h6 < Circle - OneThird) ? h6 + OneThird : h6 + OneThird - Circle;
+        uint32_t hb = (h6 < OneThird) ? h6 + Circle - OneThird : h6 - OneThird;
+
+        uint16_t ls = _Scale16(l, s);
+        uint32_t q32 = (l < 0x8000) ? static_cast<uint32_t>(l) + ls : static_cast<uint32_t>(l) + s - ls;
+        uint16_t q = (q32 > 0xffff) ? 0xffff : static_cast<uint16_t>(q32);
+        int32_t p32 = 2 * static_cast<int32_t>(l) - q;
+        uint16_t p = (p32 < 0) ? 0 : static_cast<uint16_t>(p32);
+
+        *r = _CalcColor(p, q, hr);
+        *g = _CalcColor(p, q, h6);
+        *b = _CalcColor(p, q, hb);
+    }
+}
+
+void RgbColorBase::_HsbToRgb(const Hsb48Color& color, uint16_t* r, uint16_t* g, uint16_t* b)
+{
+    uint16_t s = color.S;
+    uint16_t v = color.B;
+
+    if (s == 0)
+    {
+        *r = *g = *b = v; // achromatic or black
+    }
+    else
+    {
+        // hue wraps naturally as it covers the full range of uint16_t
+        uint32_t h = static_cast<uint32_t>(color.H) * 6;
+        uint8_t i = h >> 16;
+        uint16_t f = h & 0xffff;
+
+        uint16_t q = _Scale16(v, 0xffff - _Scale16(s, f));
+        uint16_t p = _Scale16(v, 0xffff - s);
+        uint16_t t = _Scale16(v, 0xffff - _Scale16(s, 0xffff - f));
+
+        switch (i)
+        {
+        case 0:
+            *r = v;
+            *g = t;
+            *b = p;
+            break;
+        case 1:
+            *r = q;
+            *g = v;
+            *b = p;
+            break;
+        case 2:
+            *r = p;
+            *g = v;
+            *b = t;
+            break;
+        case 3:
+            *r = p;
+            *g = q;
+            *b = v;
+            break;
+        case 4:
+            *r = t;
+            *g = p;
+            *b = v;
+            break;
+        default:
+            *r = v;
+            *g = p;
+            *b = q;
+            break;
+        }
+    }
+}
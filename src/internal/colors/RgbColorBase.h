@@ -27,6 +27,8 @@ License along with NeoPixel.  If not, see
 
 struct HslColor;
 struct HsbColor;
+struct Hsl48Color;
+struct Hsb48Color;
 struct HtmlColor;
 struct Rgb16Color;
 
@@ -40,6 +42,24 @@ protected:
 
     static void _HsbToRgb(const HsbColor& color, float* r, float* g, float* b);
 
+    // fixed point versions, results are (0 - 65535)
+    // specifically avoids float math
+    // t is the hue in sixths of the circle scaled by 65536 (0 - 393215)
+    static uint16_t _CalcColor(uint16_t p, uint16_t q, uint32_t t);
+
+    static void _HslToRgb(const Hsl48Color& color, uint16_t* r, uint16_t* g, uint16_t* b);
+
+    static void _HsbToRgb(const Hsb48Color& color, uint16_t* r, uint16_t* g, uint16_t* b);
+
+    // scales value by ratio where both are (0 - 65535) and 65535 represents 1.0
+    // returns a correctly rounded value*ratio/65535 without a divide
+    inline static uint16_t _Scale16(uint16_t value, uint16_t ratio)
+    {
+        uint32_t temp = static_cast<uint32_t>(value) * ratio + 0x8000;
+
+        return static_cast<uint16_t>((temp + (temp >> 16)) >> 16);
+    }
+
     template <typename T_COLOR, typename T_RESULT> static T_RESULT _Compare(
         const T_COLOR& left,
         const T_COLOR& right,
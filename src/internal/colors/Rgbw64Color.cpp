@@ -170,6 +170,17 @@ Rgbw64Color Rgbw64Color::LinearBlend(const Rgbw64Color& left, const Rgbw64Color&
         left.W + (((static_cast<int64_t>(right.W) - left.W) * static_cast<int64_t>(progress) + 1) >> 8));
 }
 
+Rgbw64Color Rgbw64Color::LinearBlend(const Rgbw64Color& left, const Rgbw64Color& right, uint16_t progress)
+{
+    // scaled so 65535 is a full step to right
+    int64_t p = static_cast<int64_t>(progress) + (progress >> 15);
+
+    return Rgbw64Color(left.R + (((static_cast<int64_t>(right.R) - left.R) * p) >> 16),
+        left.G + (((static_cast<int64_t>(right.G) - left.G) * p) >> 16),
+        left.B + (((static_cast<int64_t>(right.B) - left.B) * p) >> 16),
+        left.W + (((static_cast<int64_t>(right.W) - left.W) * p) >> 16));
+}
+
 Rgbw64Color Rgbw64Color::BilinearBlend(const Rgbw64Color& c00, 
     const Rgbw64Color& c01, 
     const Rgbw64Color& c10, 
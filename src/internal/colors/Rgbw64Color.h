@@ -282,6 +282,10 @@ struct Rgbw64Color : RgbColorBase
     //     and a value between will blend the color weighted linearly between them
     // ------------------------------------------------------------------------
     static Rgbw64Color LinearBlend(const Rgbw64Color& left, const Rgbw64Color& right, uint8_t progress);
+    // progress - (0 - 65535) value where 0 will return left and 65535 will return right
+    //     and a value between will blend the color weighted linearly between them
+    // ------------------------------------------------------------------------
+    static Rgbw64Color LinearBlend(const Rgbw64Color& left, const Rgbw64Color& right, uint16_t progress);
 
     // ------------------------------------------------------------------------
     // BilinearBlend between four colors by the amount defined by 2d variable
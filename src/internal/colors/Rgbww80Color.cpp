@@ -199,6 +199,18 @@ Rgbww80Color Rgbww80Color::LinearBlend(const Rgbww80Color& left, const Rgbww80Co
         left.CW + (((static_cast<int64_t>(right.CW) - left.CW) * static_cast<int64_t>(progress) + 1) >> 8));
 }
 
+Rgbww80Color Rgbww80Color::LinearBlend(const Rgbww80Color& left, const Rgbww80Color& right, uint16_t progress)
+{
+    // scaled so 65535 is a full step to right
+    int64_t p = static_cast<int64_t>(progress) + (progress >> 15);
+
+    return Rgbww80Color(left.R + (((static_cast<int64_t>(right.R) - left.R) * p) >> 16),
+        left.G + (((static_cast<int64_t>(right.G) - left.G) * p) >> 16),
+        left.B + (((static_cast<int64_t>(right.B) - left.B) * p) >> 16),
+        left.WW + (((static_cast<int64_t>(right.WW) - left.WW) * p) >> 16),
+        left.CW + (((static_cast<int64_t>(right.CW) - left.CW) * p) >> 16));
+}
+
 Rgbww80Color Rgbww80Color::BilinearBlend(const Rgbww80Color& c00, 
     const Rgbww80Color& c01, 
     const Rgbww80Color& c10, 
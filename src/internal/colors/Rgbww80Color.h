@@ -293,6 +293,10 @@ struct Rgbww80Color : RgbColorBase
     //     and a value between will blend the color weighted linearly between them
     // ------------------------------------------------------------------------
     static Rgbww80Color LinearBlend(const Rgbww80Color& left, const Rgbww80Color& right, uint8_t progress);
+    // progress - (0 - 65535) value where 0 will return left and 65535 will return right
+    //     and a value between will blend the color weighted linearly between them
+    // ------------------------------------------------------------------------
+    static Rgbww80Color LinearBlend(const Rgbww80Color& left, const Rgbww80Color& right, uint16_t progress);
 
     // ------------------------------------------------------------------------
     // BilinearBlend between four colors by the amount defined by 2d variable
@@ -42,9 +42,13 @@ public:
     DotStarMethodBase(uint8_t pinClock, uint8_t pinData, uint16_t pixelCount, size_t elementSize, size_t settingsSize) :
         _sizeData(pixelCount * elementSize + settingsSize),
         _sizeEndFrame((pixelCount + 15) / 16), // 16 = div 2 (bit for every two pixels) div 8 (bits to bytes)
+        _sizeFrame(StartFrameSize + _sizeData + ResetFrameSize + _sizeEndFrame),
         _wire(pinClock, pinData)
     {
-        _data = static_cast<uint8_t*>(malloc(_sizeData));
+        _data = static_cast<uint8_t*>(malloc(_sizeFrame));
+        // the start, reset and end frames surround the data and never change
+        memset(_data, 0x00, StartFrameSize);
+        memset(_data + StartFrameSize + _sizeData, 0x00, ResetFrameSize + _sizeEndFrame);
         // data cleared later in Begin()
     }
 
@@ -79,27 +83,10 @@ public:
 
     void Update(bool)
     {
-        const uint8_t startFrame[4] = { 0x00 };
-        const uint8_t resetFrame[4] = { 0x00 };
-        
         _wire.beginTransaction();
 
-        // start frame
-        _wire.transmitBytes(startFrame, sizeof(startFrame));
-        
-        // data
-        _wire.transmitBytes(_data, _sizeData);
-
-        // reset frame
-        _wire.transmitBytes(resetFrame, sizeof(resetFrame));
-        
-        // end frame 
-        //
-        // one bit for every two pixels with no less than 1 byte
-        for (size_t endFrameByte = 0; endFrameByte < _sizeEndFrame; endFrameByte++)
-        {
-            _wire.transmitByte(0x00);
-        }
+        // start frame, data, reset frame, and end frame all sent at once
+        _wire.transmitBytes(_data, _sizeFrame);
         
         _wire.endTransaction();
     }
@@ -117,7 +104,7 @@ public:
 
     uint8_t* getData() const
     {
-        return _data;
+        return _data + StartFrameSize;
     };
 
     size_t getDataSize() const
@@ -131,11 +118,15 @@ public:
     }
 
 private:
-    const size_t   _sizeData;   // Size of '_data' buffer below
-    const size_t   _sizeEndFrame;
+    static const size_t StartFrameSize = 4;
+    static const size_t ResetFrameSize = 4;
+
+    const size_t   _sizeData;   // Size of LED color values within '_data' buffer below
+    const size_t   _sizeEndFrame; // one bit for every two pixels with no less than 1 byte
+    const size_t   _sizeFrame;  // Size of '_data' buffer below
 
     T_TWOWIRE _wire;
-    uint8_t* _data;       // Holds LED color values
+    uint8_t* _data;       // Holds start/reset/end frames and LED color values
 };
 
 typedef DotStarMethodBase<TwoWireBitBangImple> DotStarMethod;
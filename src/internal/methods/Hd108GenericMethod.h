@@ -43,7 +43,12 @@ public:
         _sizeData(pixelCount * elementSize + settingsSize),
         _wire(pinClock, pinData)
     {
-        _data = static_cast<uint8_t*>(malloc(_sizeData));
+        const uint8_t endFrame[EndFrameSize] = { 0xff };
+
+        _data = static_cast<uint8_t*>(malloc(StartFrameSize + _sizeData + EndFrameSize));
+        // the start and end frames surround the data and never change
+        memset(_data, 0x00, StartFrameSize);
+        memcpy(_data + StartFrameSize + _sizeData, endFrame, EndFrameSize);
         // data cleared later in Begin()
     }
 
@@ -78,19 +83,10 @@ public:
 
     void Update(bool)
     {
-        const uint8_t startFrame[16] = { 0x00 };
-        const uint8_t endFrame[4] = { 0xff };
-        
         _wire.beginTransaction();
 
-        // start frame
-        _wire.transmitBytes(startFrame, sizeof(startFrame));
-        
-        // data
-        _wire.transmitBytes(_data, _sizeData);
-
-        // end frame
-        _wire.transmitBytes(endFrame, sizeof(endFrame));
+        // start frame, data, and end frame all sent at once
+        _wire.transmitBytes(_data, StartFrameSize + _sizeData + EndFrameSize);
         
         _wire.endTransaction();
     }
@@ -108,7 +104,7 @@ public:
 
     uint8_t* getData() const
     {
-        return _data;
+        return _data + StartFrameSize;
     };
 
     size_t getDataSize() const
@@ -122,10 +118,13 @@ public:
     }
 
 private:
-    const size_t   _sizeData;   // Size of '_data' buffer below
+    static const size_t StartFrameSize = 16;
+    static const size_t EndFrameSize = 4;
+
+    const size_t   _sizeData;   // Size of LED color values within '_data' buffer below
 
     T_TWOWIRE _wire;
-    uint8_t* _data;       // Holds LED color values
+    uint8_t* _data;       // Holds start/end frames and LED color values
 };
 
 typedef Hd108MethodBase<TwoWireBitBangImple> Hd108Method;
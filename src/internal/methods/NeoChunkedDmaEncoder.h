@@ -0,0 +1,213 @@
+/*-------------------------------------------------------------------------
+NeoChunkedDmaEncoder provides streaming of encoded pixel data through a
+small ring of DMA chunks for the one wire methods.
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+// ------------------------------------------------------------------------
+// NeoDmaSourceCursor walks the source data a chunk at a time
+// ------------------------------------------------------------------------
+class NeoDmaSourceCursor
+{
+public:
+    NeoDmaSourceCursor() :
+        _data(nullptr),
+        _sizeData(0),
+        _index(0)
+    {
+    }
+
+    void Reset(const uint8_t* data, size_t sizeData)
+    {
+        _data = data;
+        _sizeData = sizeData;
+        _index = 0;
+    }
+
+    size_t Remaining() const
+    {
+        return _sizeData - _index;
+    }
+
+    // ------------------------------------------------------------------------
+    // Take returns the next of the data, up to sizeMax bytes of it
+    // sizeTaken - the count of bytes returned, zero once all is taken
+    // ------------------------------------------------------------------------
+    const uint8_t* Take(size_t sizeMax, size_t* sizeTaken)
+    {
+        const uint8_t* data = _data + _index;
+        size_t size = Remaining();
+
+        if (size > sizeMax)
+        {
+            size = sizeMax;
+        }
+        _index += size;
+
+        *sizeTaken = size;
+        return data;
+    }
+
+private:
+    const uint8_t* _data;
+    size_t _sizeData;
+    size_t _index;
+};
+
+// ------------------------------------------------------------------------
+// NeoChunkedDmaEncoder encodes a frame into a fixed ring of DMA chunks,
+// refilling each chunk with the next of the frame once it has been sent,
+// so that the DMA memory needed no longer grows with the pixel count.
+// It knows nothing of the platform; the method allocates the DMA buffer, 
+// links a descriptor to each slot in a loop and calls ChunkSent() from its 
+// descriptor completion interrupt (or polling).
+//
+// T_POLICY - the encoder of the method, providing
+//      DmaBytesPerDataByte - encoded size of each data byte
+//      ChunkDataAlignment - data bytes a chunk must be a multiple of, so
+//          the encoding of each chunk starts on a sample
+//      DmaOverrun - bytes the encoder may write past the encoded size
+//      EncodeIntoDma(dmaBuffer, data, sizeData)
+//      EncodedDmaSize(sizeData) - bytes encoded for sizeData, rounded to samples
+//      FillIdleDma(dmaBuffer, sizeDma) - the idle (reset) signal
+// V_CHUNK_DATA_SIZE - data bytes encoded into each chunk
+// V_SLOT_COUNT - chunks in the ring, two or more
+// ------------------------------------------------------------------------
+template<typename T_POLICY, size_t V_CHUNK_DATA_SIZE, uint8_t V_SLOT_COUNT = 2> 
+class NeoChunkedDmaEncoder
+{
+public:
+    static_assert(V_CHUNK_DATA_SIZE % T_POLICY::ChunkDataAlignment == 0, 
+        "V_CHUNK_DATA_SIZE must be a multiple of T_POLICY::ChunkDataAlignment");
+    static_assert(V_SLOT_COUNT >= 2, "V_SLOT_COUNT must be at least 2");
+
+    const static size_t ChunkDataSize = V_CHUNK_DATA_SIZE;
+    const static size_t ChunkDmaSize = V_CHUNK_DATA_SIZE * T_POLICY::DmaBytesPerDataByte;
+    // slots are spaced for the overrun and 4 byte aligned
+    const static size_t SlotStride = ((ChunkDmaSize + T_POLICY::DmaOverrun + 3) / 4) * 4;
+    const static uint8_t SlotCount = V_SLOT_COUNT;
+    const static size_t DmaBufferSize = SlotStride * V_SLOT_COUNT;
+
+    NeoChunkedDmaEncoder() :
+        _dmaBuffer(nullptr),
+        _countChunks(0),
+        _chunksSent(0),
+        _slotNext(0)
+    {
+    }
+
+    // ------------------------------------------------------------------------
+    // Attach the DMA buffer, DmaBufferSize bytes of DMA capable memory
+    // ------------------------------------------------------------------------
+    void Attach(uint8_t* dmaBuffer)
+    {
+        _dmaBuffer = dmaBuffer;
+    }
+
+    uint8_t* Slot(uint8_t slot) const
+    {
+        return _dmaBuffer + slot * SlotStride;
+    }
+
+    // ------------------------------------------------------------------------
+    // Start a frame, filling every slot
+    // sizeResetDma - the bytes of idle signal to follow the data
+    // returns - the count of chunks in the frame, including the reset,
+    //      the last chunk padded with idle signal
+    // ------------------------------------------------------------------------
+    size_t Start(const uint8_t* data, size_t sizeData, size_t sizeResetDma)
+    {
+        size_t sizeDma = sizeData * T_POLICY::DmaBytesPerDataByte + sizeResetDma;
+
+        _cursor.Reset(data, sizeData);
+        _countChunks = (sizeDma + ChunkDmaSize - 1) / ChunkDmaSize;
+        _chunksSent = 0;
+        _slotNext = 0;
+
+        for (uint8_t slot = 0; slot < SlotCount; slot++)
+        {
+            FillNext();
+        }
+
+        return _countChunks;
+    }
+
+    // ------------------------------------------------------------------------
+    // ChunkSent refills the slot of the chunk just sent, the oldest, 
+    // with the next chunk of the frame or with idle once past the frame
+    // returns - true once every chunk of the frame has been sent
+    // ------------------------------------------------------------------------
+    bool ChunkSent()
+    {
+        _chunksSent++;
+        FillNext();
+        return IsDone();
+    }
+
+    bool IsDone() const
+    {
+        return (_chunksSent >= _countChunks);
+    }
+
+    size_t ChunkCount() const
+    {
+        return _countChunks;
+    }
+
+    // the slot that the next call to ChunkSent() will refill
+    uint8_t NextSlot() const
+    {
+        return _slotNext;
+    }
+
+private:
+    NeoDmaSourceCursor _cursor;
+    uint8_t* _dmaBuffer;
+    size_t _countChunks;
+    size_t _chunksSent;
+    uint8_t _slotNext;
+
+    void FillNext()
+    {
+        uint8_t* pDma = Slot(_slotNext);
+        size_t sizeEncoded = 0;
+        size_t sizeTaken;
+        const uint8_t* data = _cursor.Take(ChunkDataSize, &sizeTaken);
+
+        if (sizeTaken)
+        {
+            T_POLICY::EncodeIntoDma(pDma, data, sizeTaken);
+            sizeEncoded = T_POLICY::EncodedDmaSize(sizeTaken);
+        }
+        T_POLICY::FillIdleDma(pDma + sizeEncoded, ChunkDmaSize - sizeEncoded);
+
+        _slotNext++;
+        if (_slotNext >= SlotCount)
+        {
+            _slotNext = 0;
+        }
+    }
+};
@@ -0,0 +1,156 @@
+/*-------------------------------------------------------------------------
+NeoDmx512Encoder provides platform independent DMX512 and WS2821 framing.
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+// ------------------------------------------------------------------------
+// DMX512 and WS2821 share the same framing, a long Break (space) followed
+// by a Mark After Break (MAB) and then slots of 8N2 serial data, a space 
+// start bit, 8 data bits sent least significant first, and two mark stop
+// bits; where the first slot is the start code which is always zero.  
+// They only differ in the bit rate and in the length of the break.
+// ------------------------------------------------------------------------
+class NeoDmx512Protocol
+{
+public:
+    const static uint16_t BitSendTimeNs = 4000; // 250Kbps
+    // Break min 92us (23 bits), 29 bits (116us) sent for margin
+    // Mab min 12us (3 bits), 3 bits sent
+    const static size_t BreakMabBits = 32;
+    const static size_t HeaderSize = 1; // start code slot, DMX requires it to be zero
+};
+
+class NeoWs2821Protocol
+{
+public:
+    const static uint16_t BitSendTimeNs = 1333; // 750Kbps
+    // Break min 88us (66 bits), 93 bits (124us) sent for margin
+    // Mab min 4us (3 bits), 3 bits sent
+    const static size_t BreakMabBits = 96;
+    const static size_t HeaderSize = 1; // start code slot, WS2821 requires it to be zero
+};
+
+// ------------------------------------------------------------------------
+// NeoDmx512Encoder encodes slot data into a bit stream with one element
+// bit per signal bit, sent from the most significant bit of each element.
+// It knows nothing of the peripheral, so the same stream can be sent by
+// any that shift out bits at the protocol bit rate (I2S, RMT, ...).
+// 
+// T_INVERT - NeoBitsNotInverted (mark is high) or NeoBitsInverted
+// ------------------------------------------------------------------------
+template<typename T_INVERT> class NeoDmx512Encoder
+{
+public:
+    const static size_t SlotBits = 11; // start, 8 data, 2 stop
+    const static size_t MabBits = 3; // long enough for both protocols
+
+    // ------------------------------------------------------------------------
+    // EncodedSize returns the count of T_WORD elements needed for the frame
+    // ------------------------------------------------------------------------
+    template<typename T_WORD> static size_t EncodedSize(size_t sizeData, size_t breakMabBits)
+    {
+        const size_t WordBits = sizeof(T_WORD) * 8;
+
+        return (breakMabBits + sizeData * SlotBits + WordBits - 1) / WordBits;
+    }
+
+    // ------------------------------------------------------------------------
+    // Encode writes the Break, Mab, then each source byte as a slot, and
+    // fills the rest of the output with mark (Mtbp)
+    // T_WORD - uint8_t or uint32_t, the output element type
+    // breakMabBits - total bits of the Break and Mab, the last MabBits of 
+    //      which are the Mab
+    // ------------------------------------------------------------------------
+    template<typename T_WORD> static void Encode(const uint8_t* pSrc, 
+        const uint8_t* pSrcEnd,
+        T_WORD* pOutput, 
+        const T_WORD* pOutputEnd,
+        size_t breakMabBits)
+    {
+        const uint8_t WordBits = sizeof(T_WORD) * 8;
+        const T_WORD Mark = static_cast<T_WORD>(~0);
+        const T_WORD Invert = T_INVERT::Inverted ? Mark : 0;
+
+        // bits are shifted into the bottom and leave from the top,
+        // so there are never more than WordBits + 32 bits pending
+        uint64_t pending = 0;
+        uint8_t pendingBits = 0;
+
+        // Break is space, taken in chunks so they fit with the pending bits
+        size_t breakBits = breakMabBits - MabBits;
+
+        while (breakBits)
+        {
+            uint8_t bits = (breakBits > 32) ? 32 : breakBits;
+
+            pending <<= bits;
+            pendingBits += bits;
+            breakBits -= bits;
+            while (pendingBits >= WordBits)
+            {
+                pendingBits -= WordBits;
+                *(pOutput++) = static_cast<T_WORD>(pending >> pendingBits) ^ Invert;
+            }
+        }
+
+        // Mab is mark
+        pending = (pending << MabBits) | 0b111;
+        pendingBits += MabBits;
+        while (pendingBits >= WordBits)
+        {
+            pendingBits -= WordBits;
+            *(pOutput++) = static_cast<T_WORD>(pending >> pendingBits) ^ Invert;
+        }
+
+        // each slot is a space start bit, data LSB first, two mark stop bits
+        while (pSrc < pSrcEnd)
+        {
+            uint16_t slot = (static_cast<uint16_t>(NeoUtil::Reverse8Bits(*(pSrc++))) << 2) | 0b11;
+
+            pending = (pending << SlotBits) | slot;
+            pendingBits += SlotBits;
+            while (pendingBits >= WordBits)
+            {
+                pendingBits -= WordBits;
+                *(pOutput++) = static_cast<T_WORD>(pending >> pendingBits) ^ Invert;
+            }
+        }
+
+        if (pendingBits)
+        {
+            // pad last element with mark
+            uint8_t padBits = WordBits - pendingBits;
+
+            *(pOutput++) = static_cast<T_WORD>((pending << padBits) | (Mark >> pendingBits)) ^ Invert;
+        }
+
+        // fill the rest of the output with mark
+        while (pOutput < pOutputEnd)
+        {
+            *(pOutput++) = Mark ^ Invert;
+        }
+    }
+};
@@ -76,6 +76,21 @@ class NeoEsp32I2sCadence4Step
 public:
     const static size_t DmaBitsPerPixelBit = 4; // 4 step cadence, matches encoding
 
+    // NeoChunkedDmaEncoder policy
+    const static size_t DmaBytesPerDataByte = DmaBitsPerPixelBit;
+    const static size_t ChunkDataAlignment = 1;
+    const static size_t DmaOverrun = 0;
+
+    static size_t EncodedDmaSize(size_t sizeData)
+    {
+        return sizeData * DmaBytesPerDataByte;
+    }
+
+    static void FillIdleDma(uint8_t* dmaBuffer, size_t sizeDma)
+    {
+        memset(dmaBuffer, 0x00, sizeDma);
+    }
+
     static void EncodeIntoDma(uint8_t* dmaBuffer, const uint8_t* data, size_t sizeData)
     {
         const uint16_t bitpatterns[16] =
@@ -106,72 +121,64 @@ class NeoEsp32I2sCadence3Step
 public:
     const static size_t DmaBitsPerPixelBit = 3; // 3 step cadence, matches encoding
 
+    // NeoChunkedDmaEncoder policy
+    const static size_t DmaBytesPerDataByte = DmaBitsPerPixelBit;
+    const static size_t ChunkDataAlignment = 4; // whole 32 bit dma words
+    const static size_t DmaOverrun = sizeof(uint16_t); // the cleared sample
+
+    static size_t EncodedDmaSize(size_t sizeData)
+    {
+        // rounded to whole samples
+        return ((sizeData * DmaBytesPerDataByte + 1) / 2) * 2;
+    }
+
+    static void FillIdleDma(uint8_t* dmaBuffer, size_t sizeDma)
+    {
+        memset(dmaBuffer, 0x00, sizeDma);
+    }
+
     static void EncodeIntoDma(uint8_t* dmaBuffer, const uint8_t* data, size_t sizeData)
     {
-        const uint16_t OneBit =  0b00000110;
-        const uint16_t ZeroBit = 0b00000100;
-        const uint8_t SrcBitMask = 0x80;
-        const size_t BitsInSample = sizeof(uint16_t) * 8;
+        // each nibble is four 3 bit symbols, 0 = 100, 1 = 110
+        const uint16_t bitpatterns[16] =
+        {
+            0b100100100100, 0b100100100110, 0b100100110100, 0b100100110110,
+            0b100110100100, 0b100110100110, 0b100110110100, 0b100110110110,
+            0b110100100100, 0b110100100110, 0b110100110100, 0b110100110110,
+            0b110110100100, 0b110110100110, 0b110110110100, 0b110110110110,
+        };
 
         uint16_t* pDma = reinterpret_cast<uint16_t*>(dmaBuffer);
-        uint16_t dmaValue = 0;
-        uint8_t destBitsLeft = BitsInSample;
-
         const uint8_t* pSrc = data;
-        const uint8_t* pEnd = pSrc + sizeData;
+        const uint8_t* pEnd = data + sizeData;
+        // two source bytes are 48 bits, exactly three dma samples
+        const uint8_t* pEndPairs = data + (sizeData & ~static_cast<size_t>(1));
 
-        while (pSrc < pEnd)
+        while (pSrc < pEndPairs)
         {
-            uint8_t value = *(pSrc++);
-
-            for (uint8_t bitSrc = 0; bitSrc < 8; bitSrc++)
-            {
-                const uint16_t Bit = ((value & SrcBitMask) ? OneBit : ZeroBit);
-
-                if (destBitsLeft > 3)
-                {
-                    destBitsLeft -= 3;
-                    dmaValue |= Bit << destBitsLeft;
-
-#if defined(NEO_DEBUG_DUMP_I2S_BUFFER)
-                    NeoUtil::PrintBin<uint32_t>(dmaValue);
-                    Serial.print(" < ");
-                    Serial.println(destBitsLeft);
-#endif
-                }
-                else if (destBitsLeft <= 3)
-                {
-                    uint8_t bitSplit = (3 - destBitsLeft);
-                    dmaValue |= Bit >> bitSplit;
+            uint32_t first = (static_cast<uint32_t>(bitpatterns[(*pSrc) >> 4]) << 12) | bitpatterns[(*pSrc) & 0x0f];
+            pSrc++;
+            uint32_t second = (static_cast<uint32_t>(bitpatterns[(*pSrc) >> 4]) << 12) | bitpatterns[(*pSrc) & 0x0f];
+            pSrc++;
+
+            *(pDma++) = first >> 8;
+            *(pDma++) = (first << 8) | (second >> 16);
+            *(pDma++) = second;
+        }
 
-#if defined(NEO_DEBUG_DUMP_I2S_BUFFER)
-                    NeoUtil::PrintBin<uint32_t>(dmaValue);
-                    Serial.print(" > ");
-                    Serial.println(bitSplit);
-#endif
-                    // next dma value, store and reset
-                    *(pDma++) = dmaValue; 
-                    dmaValue = 0;
-                    
-                    destBitsLeft = BitsInSample - bitSplit;
-                    if (bitSplit)
-                    {
-                        dmaValue |= Bit << destBitsLeft;
-                    }
+        if (pSrc < pEnd)
+        {
+            // odd byte left, half of its last sample is used
+            uint32_t first = (static_cast<uint32_t>(bitpatterns[(*pSrc) >> 4]) << 12) | bitpatterns[(*pSrc) & 0x0f];
 
-#if defined(NEO_DEBUG_DUMP_I2S_BUFFER)
-                    NeoUtil::PrintBin<uint32_t>(dmaValue);
-                    Serial.print(" v ");
-                    Serial.println(bitSplit);
-#endif
-                }
-                
-                // Next
-                value <<= 1;
-            }
+            *(pDma++) = first >> 8;
+            *(pDma++) = first << 8;
+        }
+        else
+        {
+            // the sample following the data is always cleared
+            *(pDma++) = 0;
         }
-        // store the remaining bits
-        *pDma++ = dmaValue;
     }
 };
 
@@ -35,6 +35,9 @@ extern "C"
 #include "Esp32_i2s.h"
 }
 
+#include "NeoMuxTranspose.h"
+#include "NeoDmx512Encoder.h"
+
 #pragma once
 
 // ESP32 Endian Map
@@ -111,6 +114,36 @@ public:
             }
         }
     }
+
+    // encodes all buses in one pass, writing every dma element once
+    static void EncodeAllIntoDma(uint8_t* dmaBuffer, const uint8_t* const* busData, const size_t* busDataSize, size_t sizeData)
+    {
+        uint8_t* pDma = dmaBuffer;
+#if defined(CONFIG_IDF_TARGET_ESP32S2)
+        const uint8_t offsetMap[] = { 0, 1, 2, 3 }; // i2s sample is two 16bit values
+
+#else
+        const uint8_t offsetMap[] = { 2,3,0,1 }; // i2s sample is two 16bit values
+
+#endif
+        uint8_t planes[8];
+
+        for (size_t index = 0; index < sizeData; index++)
+        {
+            uint8_t present = NeoMuxTranspose::Gather8(planes, busData, busDataSize, index);
+
+            // 8 bits of 3 cadence steps is exactly 6 samples of 4
+            for (uint8_t step = 0; step < 24; step += 3)
+            {
+                uint8_t plane = planes[step / 3];
+
+                pDma[(step & ~3) + offsetMap[step & 3]] = present;
+                pDma[((step + 1) & ~3) + offsetMap[(step + 1) & 3]] = plane;
+                pDma[((step + 2) & ~3) + offsetMap[(step + 2) & 3]] = 0;
+            }
+            pDma += 24;
+        }
+    }
 };
 
 
@@ -175,6 +208,34 @@ public:
             }
         }
     }
+
+    // encodes all buses in one pass, writing every dma element once
+    static void EncodeAllIntoDma(uint8_t* dmaBuffer, const uint8_t* const* busData, const size_t* busDataSize, size_t sizeData)
+    {
+        uint16_t* pDma = reinterpret_cast<uint16_t*>(dmaBuffer);
+#if defined(CONFIG_IDF_TARGET_ESP32S2)
+        const uint8_t offsetMap[] = { 0, 1, 2, 3 }; // i2s sample is two 16bit values
+#else
+        const uint8_t offsetMap[] = { 1, 0, 3, 2 }; // i2s sample is two 16bit values
+#endif
+        uint16_t planes[8];
+
+        for (size_t index = 0; index < sizeData; index++)
+        {
+            uint16_t present = NeoMuxTranspose::Gather16(planes, busData, busDataSize, index);
+
+            // 8 bits of 3 cadence steps is exactly 6 samples of 4
+            for (uint8_t step = 0; step < 24; step += 3)
+            {
+                uint16_t plane = planes[step / 3];
+
+                pDma[(step & ~3) + offsetMap[step & 3]] = present;
+                pDma[((step + 1) & ~3) + offsetMap[(step + 1) & 3]] = plane;
+                pDma[((step + 2) & ~3) + offsetMap[(step + 2) & 3]] = 0;
+            }
+            pDma += 24;
+        }
+    }
 };
 
 
@@ -190,28 +251,6 @@ public:
 
     static void EncodeIntoDma(uint8_t* dmaBuffer, const uint8_t* data, size_t sizeData, uint8_t muxId)
     {
-#if defined(CONFIG_IDF_TARGET_ESP32S2)
-
-        const uint32_t EncodedZeroBit = 0x00000001;
-        const uint32_t EncodedOneBit = 0x00010101;
-
-#else
-        //  8 channel bits layout for DMA 32bit value
-        //  note, right to left
-        //  mux bus bit/id     76543210 76543210 76543210 76543210
-        //  encode bit #       3        2        1        0
-        //  value zero         0        0        0        1
-        //  value one          0        1        1        1    
-        //
-        // due to indianness between peripheral and cpu, bytes within the words are swapped in the const
-        // 1234  - order
-        // 3412  = actual due to endianness
-        //                                00000001
-        const uint32_t EncodedZeroBit = 0x00010000;
-        //                               00010101
-        const uint32_t EncodedOneBit = 0x01010001;
-#endif
-
         uint32_t* pDma = reinterpret_cast<uint32_t*>(dmaBuffer);
         const uint8_t* pEnd = data + sizeData;
         const uint32_t OneBit = EncodedOneBit << muxId;
@@ -231,6 +270,50 @@ public:
             }
         }
     }
+
+    // encodes all buses in one pass, writing every dma value once
+    static void EncodeAllIntoDma(uint8_t* dmaBuffer, const uint8_t* const* busData, const size_t* busDataSize, size_t sizeData)
+    {
+        // the encodings only use 0 or 1 in each byte, so multiplying by the 
+        // transposed values places each bus bit without any carry
+        const uint32_t EncodedDataBit = EncodedOneBit ^ EncodedZeroBit;
+
+        uint32_t* pDma = reinterpret_cast<uint32_t*>(dmaBuffer);
+        uint8_t planes[8];
+
+        for (size_t index = 0; index < sizeData; index++)
+        {
+            uint32_t present = NeoMuxTranspose::Gather8(planes, busData, busDataSize, index) * EncodedZeroBit;
+
+            for (uint8_t bit = 0; bit < 8; bit++)
+            {
+                *(pDma++) = present + planes[bit] * EncodedDataBit;
+            }
+        }
+    }
+
+private:
+#if defined(CONFIG_IDF_TARGET_ESP32S2)
+
+    static const uint32_t EncodedZeroBit = 0x00000001;
+    static const uint32_t EncodedOneBit = 0x00010101;
+
+#else
+    //  8 channel bits layout for DMA 32bit value
+    //  note, right to left
+    //  mux bus bit/id     76543210 76543210 76543210 76543210
+    //  encode bit #       3        2        1        0
+    //  value zero         0        0        0        1
+    //  value one          0        1        1        1    
+    //
+    // due to indianness between peripheral and cpu, bytes within the words are swapped in the const
+    // 1234  - order
+    // 3412  = actual due to endianness
+    //                                       00000001
+    static const uint32_t EncodedZeroBit = 0x00010000;
+    //                                      00010101
+    static const uint32_t EncodedOneBit = 0x01010001;
+#endif
 };
 
 // 4 step cadence, so pulses are 1/4 and 3/4 of pulse width
@@ -245,20 +328,6 @@ public:
 
     static void EncodeIntoDma(uint8_t* dmaBuffer, const uint8_t* data, size_t sizeData, uint8_t muxId)
     {
-#if defined(CONFIG_IDF_TARGET_ESP32S2)
-        const uint64_t EncodedZeroBit64 = 0x0000000000000001;
-        const uint64_t EncodedOneBit64 = 0x0000000100010001;
-
-#else
-        // 1234 5678 - order
-        // 3412 7856 = actual due to endianness
-        // not swap                         0000000000000001 
-        const uint64_t EncodedZeroBit64 = 0x0000000000010000;
-        //  no swap                         0000000100010001 
-        const uint64_t EncodedOneBit64 =  0x0001000000010001; 
-
-#endif
-        
         Fillx16(dmaBuffer,
             data,
             sizeData,
@@ -267,6 +336,42 @@ public:
             EncodedOneBit64);
     }
 
+    // encodes all buses in one pass, writing every dma value once
+    static void EncodeAllIntoDma(uint8_t* dmaBuffer, const uint8_t* const* busData, const size_t* busDataSize, size_t sizeData)
+    {
+        // the encodings only use 0 or 1 in each 16 bits, so multiplying by the 
+        // transposed values places each bus bit without any carry
+        const uint64_t EncodedDataBit64 = EncodedOneBit64 ^ EncodedZeroBit64;
+
+        uint64_t* pDma64 = reinterpret_cast<uint64_t*>(dmaBuffer);
+        uint16_t planes[8];
+
+        for (size_t index = 0; index < sizeData; index++)
+        {
+            uint64_t present = NeoMuxTranspose::Gather16(planes, busData, busDataSize, index) * EncodedZeroBit64;
+
+            for (uint8_t bit = 0; bit < 8; bit++)
+            {
+                *(pDma64++) = present + planes[bit] * EncodedDataBit64;
+            }
+        }
+    }
+
+private:
+#if defined(CONFIG_IDF_TARGET_ESP32S2)
+    static const uint64_t EncodedZeroBit64 = 0x0000000000000001;
+    static const uint64_t EncodedOneBit64 = 0x0000000100010001;
+
+#else
+    // 1234 5678 - order
+    // 3412 7856 = actual due to endianness
+    // not swap                                0000000000000001 
+    static const uint64_t EncodedZeroBit64 = 0x0000000000010000;
+    //  no swap                                0000000100010001 
+    static const uint64_t EncodedOneBit64 =  0x0001000000010001; 
+
+#endif
+
 protected:
     static void Fillx16(uint8_t* dmaBuffer, 
         const uint8_t* data,
@@ -298,6 +403,132 @@ protected:
     }
 };
 
+// 1 step, each source bit is sent as is for one bit time, 
+// used for protocols like DMX512 that are encoded into a bit stream first
+//
+class NeoEspI2sMuxBusSize8Bit1Step
+{
+public:
+    NeoEspI2sMuxBusSize8Bit1Step() {};
+
+    const static size_t MuxBusDataSize = 1;
+    const static size_t DmaBitsPerPixelBit = 1; // no cadence, matches the bit stream
+
+    static void EncodeIntoDma(uint8_t* dmaBuffer, const uint8_t* data, size_t sizeData, uint8_t muxId)
+    {
+        uint8_t* pDma = dmaBuffer;
+        const uint8_t* pValue = data;
+        const uint8_t* pEnd = pValue + sizeData;
+        const uint8_t muxBit = 0x1 << muxId;
+#if defined(CONFIG_IDF_TARGET_ESP32S2)
+        const uint8_t offsetMap[] = { 0, 1, 2, 3 }; // i2s sample is two 16bit values
+#else
+        const uint8_t offsetMap[] = { 2, 3, 0, 1 }; // i2s sample is two 16bit values
+#endif
+
+        while (pValue < pEnd)
+        {
+            uint8_t value = *(pValue++);
+
+            for (uint8_t bit = 0; bit < 8; bit++)
+            {
+                if (value & 0x80)
+                {
+                    pDma[(bit & ~3) + offsetMap[bit & 3]] |= muxBit;
+                }
+                value <<= 1;
+            }
+            pDma += 8;
+        }
+    }
+
+    // encodes all buses in one pass, writing every dma element once
+    static void EncodeAllIntoDma(uint8_t* dmaBuffer, const uint8_t* const* busData, const size_t* busDataSize, size_t sizeData)
+    {
+        uint8_t* pDma = dmaBuffer;
+#if defined(CONFIG_IDF_TARGET_ESP32S2)
+        const uint8_t offsetMap[] = { 0, 1, 2, 3 }; // i2s sample is two 16bit values
+#else
+        const uint8_t offsetMap[] = { 2, 3, 0, 1 }; // i2s sample is two 16bit values
+#endif
+        uint8_t planes[8];
+
+        for (size_t index = 0; index < sizeData; index++)
+        {
+            NeoMuxTranspose::Gather8(planes, busData, busDataSize, index);
+
+            for (uint8_t bit = 0; bit < 8; bit++)
+            {
+                pDma[(bit & ~3) + offsetMap[bit & 3]] = planes[bit];
+            }
+            pDma += 8;
+        }
+    }
+};
+
+// 1 step, each source bit is sent as is for one bit time, 
+// used for protocols like DMX512 that are encoded into a bit stream first
+//
+class NeoEspI2sMuxBusSize16Bit1Step
+{
+public:
+    NeoEspI2sMuxBusSize16Bit1Step() {};
+
+    const static size_t MuxBusDataSize = 2;
+    const static size_t DmaBitsPerPixelBit = 1; // no cadence, matches the bit stream
+
+    static void EncodeIntoDma(uint8_t* dmaBuffer, const uint8_t* data, size_t sizeData, uint8_t muxId)
+    {
+        uint16_t* pDma = reinterpret_cast<uint16_t*>(dmaBuffer);
+        const uint8_t* pValue = data;
+        const uint8_t* pEnd = pValue + sizeData;
+        const uint16_t muxBit = 0x1 << muxId;
+#if defined(CONFIG_IDF_TARGET_ESP32S2)
+        const uint8_t offsetMap[] = { 0, 1, 2, 3 }; // i2s sample is two 16bit values
+#else
+        const uint8_t offsetMap[] = { 1, 0, 3, 2 }; // i2s sample is two 16bit values
+#endif
+
+        while (pValue < pEnd)
+        {
+            uint8_t value = *(pValue++);
+
+            for (uint8_t bit = 0; bit < 8; bit++)
+            {
+                if (value & 0x80)
+                {
+                    pDma[(bit & ~3) + offsetMap[bit & 3]] |= muxBit;
+                }
+                value <<= 1;
+            }
+            pDma += 8;
+        }
+    }
+
+    // encodes all buses in one pass, writing every dma element once
+    static void EncodeAllIntoDma(uint8_t* dmaBuffer, const uint8_t* const* busData, const size_t* busDataSize, size_t sizeData)
+    {
+        uint16_t* pDma = reinterpret_cast<uint16_t*>(dmaBuffer);
+#if defined(CONFIG_IDF_TARGET_ESP32S2)
+        const uint8_t offsetMap[] = { 0, 1, 2, 3 }; // i2s sample is two 16bit values
+#else
+        const uint8_t offsetMap[] = { 1, 0, 3, 2 }; // i2s sample is two 16bit values
+#endif
+        uint16_t planes[8];
+
+        for (size_t index = 0; index < sizeData; index++)
+        {
+            NeoMuxTranspose::Gather16(planes, busData, busDataSize, index);
+
+            for (uint8_t bit = 0; bit < 8; bit++)
+            {
+                pDma[(bit & ~3) + offsetMap[bit & 3]] = planes[bit];
+            }
+            pDma += 8;
+        }
+    }
+};
+
 //
 // tracks mux channels used and if updated
 // 
@@ -315,6 +546,15 @@ public:
     T_FLAG UpdateMap;     // bitmap flags of mux buses to track update state
     T_FLAG UpdateMapMask; // mask to used bits in s_UpdateMap
     T_FLAG BusCount;      // count of mux buses
+#if defined(NPB_CONF_MUX_TRANSPOSE)
+    const uint8_t* BusData[BusMaxCount]; // data of each mux bus when encoded together
+    size_t BusDataSize[BusMaxCount];     // size of data of each mux bus, zero when unused
+#endif
+#if defined(NPB_CONF_MUX_INCREMENTAL)
+    uint8_t* BusShadow[BusMaxCount]; // copy of the data last encoded for each mux bus
+    T_FLAG EncodedMap;               // bitmap flags of mux buses whose shadow is in the dma buffer
+    T_FLAG StaleMap;                 // bitmap flags of mux buses with bits left by a deregistered mux bus
+#endif
 
     // as a static instance, all members get initialized to zero
     // and the constructor is called at inconsistent time to other globals
@@ -361,6 +601,16 @@ public:
             // complete deregistration
             BusCount--;
             UpdateMapMask &= ~muxIdField;
+#if defined(NPB_CONF_MUX_TRANSPOSE)
+            BusData[muxId] = nullptr;
+            BusDataSize[muxId] = 0;
+#endif
+#if defined(NPB_CONF_MUX_INCREMENTAL)
+            EncodedMap &= ~muxIdField;
+            StaleMap |= muxIdField;
+            free(BusShadow[muxId]);
+            BusShadow[muxId] = nullptr;
+#endif
             if (UpdateMapMask == 0)
             {
                 return true;
@@ -389,12 +639,98 @@ public:
         UpdateMap = 0;
     }
 
+#if defined(NPB_CONF_MUX_TRANSPOSE)
+    // retain the mux bus data so all buses can be encoded together,
+    // the data must remain unchanged until EncodeAllIntoDma()
+    void SetMuxBusData(uint8_t muxId, const uint8_t* data, size_t sizeData)
+    {
+        BusData[muxId] = data;
+        BusDataSize[muxId] = sizeData;
+    }
+
+    void EncodeAllIntoDma(uint8_t* dmaBuffer)
+    {
+        T_MUXSIZE::EncodeAllIntoDma(dmaBuffer, BusData, BusDataSize, MaxBusDataSize);
+    }
+#endif
+
+#if defined(NPB_CONF_MUX_INCREMENTAL)
+    // returns true if the mux bus data differs from what was last encoded 
+    // into the dma buffer, retaining a copy of the data when it does
+    bool UpdateMuxBusShadow(uint8_t muxId, const uint8_t* data, size_t sizeData)
+    {
+        T_FLAG muxIdField = (1 << muxId);
+
+        if (BusShadow[muxId] == nullptr)
+        {
+            BusShadow[muxId] = static_cast<uint8_t*>(malloc(sizeData));
+            if (BusShadow[muxId] == nullptr)
+            {
+                // without a shadow it is always treated as changed
+                return true;
+            }
+        }
+        else if ((EncodedMap & muxIdField) &&
+            memcmp(BusShadow[muxId], data, sizeData) == 0)
+        {
+            return false;
+        }
+
+        memcpy(BusShadow[muxId], data, sizeData);
+        EncodedMap |= muxIdField;
+        return true;
+    }
+
+    // clears only the bits of the mux bus, leaving the other mux buses encoded;
+    // the first clear after a deregistered mux bus used the same bits covers
+    // the whole buffer, as that mux bus may have left longer data behind
+    void ClearMuxBusInDma(uint8_t* dmaBuffer, size_t sizeData, uint8_t muxId)
+    {
+        T_FLAG muxIdField = (1 << muxId);
+
+        if (StaleMap & muxIdField)
+        {
+            StaleMap &= ~muxIdField;
+            sizeData = MaxBusDataSize;
+        }
+
+        // each dma element holds one bit from every mux bus, 
+        // so each 32 bit word holds 4 (8 bit) or 2 (16 bit) elements
+        const uint32_t LaneBits = (T_MUXSIZE::MuxBusDataSize == 1) ? 0x01010101 : 0x00010001;
+        const uint32_t clearMask = ~(LaneBits << muxId);
+        uint32_t* pDma = reinterpret_cast<uint32_t*>(dmaBuffer);
+        const uint32_t* pEnd = pDma + 
+            (sizeData * 8 * T_MUXSIZE::DmaBitsPerPixelBit * T_MUXSIZE::MuxBusDataSize) / sizeof(uint32_t);
+
+        while (pDma < pEnd)
+        {
+            *(pDma++) &= clearMask;
+        }
+    }
+#endif
+
     void Reset()
     {
         MaxBusDataSize = 0;
         UpdateMap = 0;
         UpdateMapMask = 0;
         BusCount = 0;
+#if defined(NPB_CONF_MUX_TRANSPOSE)
+        for (size_t muxId = 0; muxId < BusMaxCount; muxId++)
+        {
+            BusData[muxId] = nullptr;
+            BusDataSize[muxId] = 0;
+        }
+#endif
+#if defined(NPB_CONF_MUX_INCREMENTAL)
+        for (size_t muxId = 0; muxId < BusMaxCount; muxId++)
+        {
+            free(BusShadow[muxId]);
+            BusShadow[muxId] = nullptr;
+        }
+        EncodedMap = 0;
+        StaleMap = 0;
+#endif
     }
 };
 
@@ -493,6 +829,11 @@ public:
     {
         if (MuxMap.IsAllMuxBusesUpdated())
         {
+#if defined(NPB_CONF_MUX_TRANSPOSE)
+            // the last FillBuffers() waited for the prior write to complete
+            MuxMap.EncodeAllIntoDma(I2sBuffer);
+#endif
+
 #if defined(NEO_DEBUG_DUMP_I2S_BUFFER)
             // dump the is2buffer
             uint8_t* pDma = I2sBuffer;
@@ -541,6 +882,21 @@ public:
             yield();
         }
 
+#if defined(NPB_CONF_MUX_TRANSPOSE)
+        // encoded together with all the other mux buses in StartWrite()
+        MuxMap.SetMuxBusData(muxId, data, sizeData);
+#elif defined(NPB_CONF_MUX_INCREMENTAL)
+        // a mux bus that hasn't changed keeps its bits in the buffer, 
+        // a changed one clears and rewrites only its own bits
+        if (MuxMap.UpdateMuxBusShadow(muxId, data, sizeData))
+        {
+            MuxMap.ClearMuxBusInDma(I2sBuffer, sizeData, muxId);
+            MuxMap.EncodeIntoDma(I2sBuffer,
+                data,
+                sizeData,
+                muxId);
+        }
+#else
         // to keep the inner loops for EncodeIntoDma smaller
         // they will just OR in their values
         // so the buffer must be cleared first
@@ -554,6 +910,7 @@ public:
             data,
             sizeData,
             muxId);
+#endif
 
         MuxMap.MarkMuxBusUpdated(muxId);
     }
@@ -670,6 +1027,10 @@ public:
         {
             MuxMap.ResetMuxBusesUpdated();
 
+#if defined(NPB_CONF_MUX_TRANSPOSE)
+            MuxMap.EncodeAllIntoDma(I2sEditBuffer);
+#endif
+
             // wait for not actively sending data
             while (!i2sWriteDone(i2sBusNumber))
             {
@@ -688,6 +1049,21 @@ public:
         uint8_t muxId,
         uint8_t i2sBusNumber)
     {
+#if defined(NPB_CONF_MUX_TRANSPOSE)
+        // encoded together with all the other mux buses in StartWrite()
+        MuxMap.SetMuxBusData(muxId, data, sizeData);
+#elif defined(NPB_CONF_MUX_INCREMENTAL)
+        // a mux bus that hasn't changed keeps its bits in the buffer, 
+        // a changed one clears and rewrites only its own bits
+        if (MuxMap.UpdateMuxBusShadow(muxId, data, sizeData))
+        {
+            MuxMap.ClearMuxBusInDma(I2sEditBuffer, sizeData, muxId);
+            MuxMap.EncodeIntoDma(I2sEditBuffer,
+                data,
+                sizeData,
+                muxId);
+        }
+#else
         // to keep the inner loops for EncodeIntoDma smaller
         // they will just OR in their values
         // so the buffer must be cleared first
@@ -701,6 +1077,7 @@ public:
             data,
             sizeData,
             muxId);
+#endif
 
         MuxMap.MarkMuxBusUpdated(muxId);
     }
@@ -868,6 +1245,111 @@ private:
     uint8_t* _data;      // Holds LED color values
 };
 
+//
+// wrapping layer of the i2s mux bus as a DMX512/WS2821 NeoMethod, each mux bus
+// is a separate universe, all sent together
+// 
+// T_PROTOCOL - NeoDmx512Protocol or NeoWs2821Protocol
+// T_BUS - NeoEsp32I2sMuxBus, the bus to use, must use a 1 step mux map and so 
+//      can not share the i2s bus with other NeoEsp32I2sXMethodBase methods
+// T_INVERT - NeoBitsNotInverted or NeoBitsInverted, will invert output signal
+//
+template<typename T_PROTOCOL, typename T_BUS, typename T_INVERT> 
+class NeoEsp32I2sXDmx512MethodBase
+{
+public:
+    typedef NeoNoSettings SettingsObject;
+
+    NeoEsp32I2sXDmx512MethodBase(uint8_t pin, uint16_t pixelCount, size_t elementSize, size_t settingsSize) :
+        _sizeData(pixelCount * elementSize + settingsSize + T_PROTOCOL::HeaderSize),
+        _sizeStream(Encoder::template EncodedSize<uint8_t>(_sizeData, T_PROTOCOL::BreakMabBits)),
+        _pin(pin),
+        _bus()
+    {
+        _bus.RegisterNewMuxBus(_sizeStream);
+    }
+
+    ~NeoEsp32I2sXDmx512MethodBase()
+    {
+        while (!_bus.IsWriteDone())
+        {
+            yield();
+        }
+
+        _bus.DeregisterMuxBus(_pin);
+
+        free(_data);
+        free(_stream);
+    }
+
+    bool IsReadyToUpdate() const
+    {
+        return _bus.IsWriteDone();
+    }
+
+    void Initialize()
+    {
+        // the i2s idles and pads shorter universes with zero, so the stream 
+        // is encoded with a zero mark and the pin inverts it back to high
+        _bus.Initialize(_pin, T_PROTOCOL::BitSendTimeNs, !T_INVERT::Inverted);
+
+        _data = static_cast<uint8_t*>(malloc(_sizeData));
+        _stream = static_cast<uint8_t*>(malloc(_sizeStream));
+        if (_data == nullptr || _stream == nullptr)
+        {
+            log_e("front buffer memory allocation failure");
+            return;
+        }
+        // first "slot" cleared due to protocol requiring it to be zero
+        memset(_data, 0x00, T_PROTOCOL::HeaderSize);
+    }
+
+    void Update(bool)
+    {
+        Encoder::Encode(_data, _data + _sizeData, _stream, _stream + _sizeStream, T_PROTOCOL::BreakMabBits);
+
+        _bus.FillBuffers(_stream, _sizeStream);
+        _bus.StartWrite(); // only triggers actual write after all mux busses have updated
+    }
+
+    bool AlwaysUpdate()
+    {
+        // this method requires update to be called even if no changes to method buffer
+        // as all mux buses need to be included
+        return true;
+    }
+
+    bool SwapBuffers()
+    {
+        return false;
+    }
+
+    uint8_t* getData() const
+    {
+        return _data + T_PROTOCOL::HeaderSize;
+    };
+
+    size_t getDataSize() const
+    {
+        return _sizeData - T_PROTOCOL::HeaderSize;
+    }
+
+    void applySettings([[maybe_unused]] const SettingsObject& settings)
+    {
+    }
+
+private:
+    typedef NeoDmx512Encoder<NeoBitsInverted> Encoder;
+
+    const size_t  _sizeData;    // Size of '_data' buffer, including the start code
+    const size_t  _sizeStream;  // Size of '_stream' buffer
+    const uint8_t _pin;         // output pin number
+
+    T_BUS _bus;          // holds instance for mux bus support
+    uint8_t* _data;      // Holds slot values
+    uint8_t* _stream;    // Holds the encoded bit stream given to the mux bus
+};
+
 #if defined(NPB_CONF_4STEP_CADENCE)
 
 //------------------------------------
@@ -1088,4 +1570,45 @@ typedef NeoEsp32I2s1X16Sk6812InvertedMethod  NeoEsp32I2s1X16Lc8812InvertedMethod
 
 #endif // !defined(CONFIG_IDF_TARGET_ESP32S2)
 
+// DMX512 / WS2821
+//
+#if defined(CONFIG_IDF_TARGET_ESP32S2)
+
+typedef NeoEsp32I2sMuxBus<NeoEspI2sMonoBuffContext<NeoEspI2sMuxMap<uint8_t, NeoEspI2sMuxBusSize8Bit1Step>>, NeoEsp32I2sBusZero> NeoEsp32I2s0Dmx8Bus;
+typedef NeoEsp32I2sMuxBus<NeoEspI2sMonoBuffContext<NeoEspI2sMuxMap<uint16_t, NeoEspI2sMuxBusSize16Bit1Step>>, NeoEsp32I2sBusZero> NeoEsp32I2s0Dmx16Bus;
+
+#else
+
+typedef NeoEsp32I2sMuxBus<NeoEspI2sMonoBuffContext<NeoEspI2sMuxMap<uint8_t, NeoEspI2sMuxBusSize16Bit1Step>>, NeoEsp32I2sBusZero> NeoEsp32I2s0Dmx8Bus;
+typedef NeoEsp32I2sMuxBus<NeoEspI2sMonoBuffContext<NeoEspI2sMuxMap<uint16_t, NeoEspI2sMuxBusSize16Bit1Step>>, NeoEsp32I2sBusZero> NeoEsp32I2s0Dmx16Bus;
+
+typedef NeoEsp32I2sMuxBus<NeoEspI2sMonoBuffContext<NeoEspI2sMuxMap<uint8_t, NeoEspI2sMuxBusSize8Bit1Step>>, NeoEsp32I2sBusOne> NeoEsp32I2s1Dmx8Bus;
+typedef NeoEsp32I2sMuxBus<NeoEspI2sMonoBuffContext<NeoEspI2sMuxMap<uint16_t, NeoEspI2sMuxBusSize16Bit1Step>>, NeoEsp32I2sBusOne> NeoEsp32I2s1Dmx16Bus;
+
+#endif
+
+typedef NeoEsp32I2sXDmx512MethodBase<NeoDmx512Protocol, NeoEsp32I2s0Dmx8Bus, NeoBitsNotInverted> NeoEsp32I2s0X8Dmx512Method;
+typedef NeoEsp32I2sXDmx512MethodBase<NeoWs2821Protocol, NeoEsp32I2s0Dmx8Bus, NeoBitsNotInverted> NeoEsp32I2s0X8Ws2821Method;
+typedef NeoEsp32I2sXDmx512MethodBase<NeoDmx512Protocol, NeoEsp32I2s0Dmx16Bus, NeoBitsNotInverted> NeoEsp32I2s0X16Dmx512Method;
+typedef NeoEsp32I2sXDmx512MethodBase<NeoWs2821Protocol, NeoEsp32I2s0Dmx16Bus, NeoBitsNotInverted> NeoEsp32I2s0X16Ws2821Method;
+
+typedef NeoEsp32I2sXDmx512MethodBase<NeoDmx512Protocol, NeoEsp32I2s0Dmx8Bus, NeoBitsInverted> NeoEsp32I2s0X8Dmx512InvertedMethod;
+typedef NeoEsp32I2sXDmx512MethodBase<NeoWs2821Protocol, NeoEsp32I2s0Dmx8Bus, NeoBitsInverted> NeoEsp32I2s0X8Ws2821InvertedMethod;
+typedef NeoEsp32I2sXDmx512MethodBase<NeoDmx512Protocol, NeoEsp32I2s0Dmx16Bus, NeoBitsInverted> NeoEsp32I2s0X16Dmx512InvertedMethod;
+typedef NeoEsp32I2sXDmx512MethodBase<NeoWs2821Protocol, NeoEsp32I2s0Dmx16Bus, NeoBitsInverted> NeoEsp32I2s0X16Ws2821InvertedMethod;
+
+#if !defined(CONFIG_IDF_TARGET_ESP32S2)
+
+typedef NeoEsp32I2sXDmx512MethodBase<NeoDmx512Protocol, NeoEsp32I2s1Dmx8Bus, NeoBitsNotInverted> NeoEsp32I2s1X8Dmx512Method;
+typedef NeoEsp32I2sXDmx512MethodBase<NeoWs2821Protocol, NeoEsp32I2s1Dmx8Bus, NeoBitsNotInverted> NeoEsp32I2s1X8Ws2821Method;
+typedef NeoEsp32I2sXDmx512MethodBase<NeoDmx512Protocol, NeoEsp32I2s1Dmx16Bus, NeoBitsNotInverted> NeoEsp32I2s1X16Dmx512Method;
+typedef NeoEsp32I2sXDmx512MethodBase<NeoWs2821Protocol, NeoEsp32I2s1Dmx16Bus, NeoBitsNotInverted> NeoEsp32I2s1X16Ws2821Method;
+
+typedef NeoEsp32I2sXDmx512MethodBase<NeoDmx512Protocol, NeoEsp32I2s1Dmx8Bus, NeoBitsInverted> NeoEsp32I2s1X8Dmx512InvertedMethod;
+typedef NeoEsp32I2sXDmx512MethodBase<NeoWs2821Protocol, NeoEsp32I2s1Dmx8Bus, NeoBitsInverted> NeoEsp32I2s1X8Ws2821InvertedMethod;
+typedef NeoEsp32I2sXDmx512MethodBase<NeoDmx512Protocol, NeoEsp32I2s1Dmx16Bus, NeoBitsInverted> NeoEsp32I2s1X16Dmx512InvertedMethod;
+typedef NeoEsp32I2sXDmx512MethodBase<NeoWs2821Protocol, NeoEsp32I2s1Dmx16Bus, NeoBitsInverted> NeoEsp32I2s1X16Ws2821InvertedMethod;
+
+#endif // !defined(CONFIG_IDF_TARGET_ESP32S2)
+
 #endif // defined(ARDUINO_ARCH_ESP32) && !defined(CONFIG_IDF_TARGET_ESP32C3) && !defined(CONFIG_IDF_TARGET_ESP32S3)
@@ -41,6 +41,8 @@ extern "C"
 #include "FractionClk.h"
 }
 
+#include "NeoMuxTranspose.h"
+
 //
 // true size of mux channel, 8 bit
 // 3 step cadence, so pulses are 1/3 and 2/3 of pulse width
@@ -88,6 +90,25 @@ public:
             }
         }
     }
+
+    // encodes all buses in one pass, writing every dma element once
+    static void EncodeAllIntoDma(uint8_t* dmaBuffer, const uint8_t* const* busData, const size_t* busDataSize, size_t sizeData)
+    {
+        uint8_t* pDma = dmaBuffer;
+        uint8_t planes[8];
+
+        for (size_t index = 0; index < sizeData; index++)
+        {
+            uint8_t present = NeoMuxTranspose::Gather8(planes, busData, busDataSize, index);
+
+            for (uint8_t bit = 0; bit < 8; bit++)
+            {
+                *(pDma++) = present;
+                *(pDma++) = planes[bit];
+                *(pDma++) = 0;
+            }
+        }
+    }
 };
 
 //
@@ -136,6 +157,25 @@ public:
             }
         }
     }
+
+    // encodes all buses in one pass, writing every dma element once
+    static void EncodeAllIntoDma(uint8_t* dmaBuffer, const uint8_t* const* busData, const size_t* busDataSize, size_t sizeData)
+    {
+        uint16_t* pDma = reinterpret_cast<uint16_t*>(dmaBuffer);
+        uint16_t planes[8];
+
+        for (size_t index = 0; index < sizeData; index++)
+        {
+            uint16_t present = NeoMuxTranspose::Gather16(planes, busData, busDataSize, index);
+
+            for (uint8_t bit = 0; bit < 8; bit++)
+            {
+                *(pDma++) = present;
+                *(pDma++) = planes[bit];
+                *(pDma++) = 0;
+            }
+        }
+    }
 };
 
 //
@@ -155,6 +195,15 @@ public:
     T_FLAG UpdateMap;     // bitmap flags of mux buses to track update state
     T_FLAG UpdateMapMask; // mask to used bits in s_UpdateMap
     T_FLAG BusCount;      // count of mux buses
+#if defined(NPB_CONF_MUX_TRANSPOSE)
+    const uint8_t* BusData[BusMaxCount]; // data of each mux bus when encoded together
+    size_t BusDataSize[BusMaxCount];     // size of data of each mux bus, zero when unused
+#endif
+#if defined(NPB_CONF_MUX_INCREMENTAL)
+    uint8_t* BusShadow[BusMaxCount]; // copy of the data last encoded for each mux bus
+    T_FLAG EncodedMap;               // bitmap flags of mux buses whose shadow is in the dma buffer
+    T_FLAG StaleMap;                 // bitmap flags of mux buses with bits left by a deregistered mux bus
+#endif
 
     // as a static instance, all members get initialized to zero
     // and the constructor is called at inconsistent time to other globals
@@ -201,6 +250,16 @@ public:
             // complete deregistration
             BusCount--;
             UpdateMapMask &= ~muxIdField;
+#if defined(NPB_CONF_MUX_TRANSPOSE)
+            BusData[muxId] = nullptr;
+            BusDataSize[muxId] = 0;
+#endif
+#if defined(NPB_CONF_MUX_INCREMENTAL)
+            EncodedMap &= ~muxIdField;
+            StaleMap |= muxIdField;
+            free(BusShadow[muxId]);
+            BusShadow[muxId] = nullptr;
+#endif
             if (UpdateMapMask == 0)
             {
                 return true;
@@ -229,12 +288,98 @@ public:
         UpdateMap = 0;
     }
 
+#if defined(NPB_CONF_MUX_TRANSPOSE)
+    // retain the mux bus data so all buses can be encoded together,
+    // the data must remain unchanged until EncodeAllIntoDma()
+    void SetMuxBusData(uint8_t muxId, const uint8_t* data, size_t sizeData)
+    {
+        BusData[muxId] = data;
+        BusDataSize[muxId] = sizeData;
+    }
+
+    void EncodeAllIntoDma(uint8_t* dmaBuffer)
+    {
+        T_MUXSIZE::EncodeAllIntoDma(dmaBuffer, BusData, BusDataSize, MaxBusDataSize);
+    }
+#endif
+
+#if defined(NPB_CONF_MUX_INCREMENTAL)
+    // returns true if the mux bus data differs from what was last encoded 
+    // into the dma buffer, retaining a copy of the data when it does
+    bool UpdateMuxBusShadow(uint8_t muxId, const uint8_t* data, size_t sizeData)
+    {
+        T_FLAG muxIdField = (1 << muxId);
+
+        if (BusShadow[muxId] == nullptr)
+        {
+            BusShadow[muxId] = static_cast<uint8_t*>(malloc(sizeData));
+            if (BusShadow[muxId] == nullptr)
+            {
+                // without a shadow it is always treated as changed
+                return true;
+            }
+        }
+        else if ((EncodedMap & muxIdField) &&
+            memcmp(BusShadow[muxId], data, sizeData) == 0)
+        {
+            return false;
+        }
+
+        memcpy(BusShadow[muxId], data, sizeData);
+        EncodedMap |= muxIdField;
+        return true;
+    }
+
+    // clears only the bits of the mux bus, leaving the other mux buses encoded;
+    // the first clear after a deregistered mux bus used the same bits covers
+    // the whole buffer, as that mux bus may have left longer data behind
+    void ClearMuxBusInDma(uint8_t* dmaBuffer, size_t sizeData, uint8_t muxId)
+    {
+        T_FLAG muxIdField = (1 << muxId);
+
+        if (StaleMap & muxIdField)
+        {
+            StaleMap &= ~muxIdField;
+            sizeData = MaxBusDataSize;
+        }
+
+        // each dma element holds one bit from every mux bus, 
+        // so each 32 bit word holds 4 (8 bit) or 2 (16 bit) elements
+        const uint32_t LaneBits = (T_MUXSIZE::MuxBusDataSize == 1) ? 0x01010101 : 0x00010001;
+        const uint32_t clearMask = ~(LaneBits << muxId);
+        uint32_t* pDma = reinterpret_cast<uint32_t*>(dmaBuffer);
+        const uint32_t* pEnd = pDma + 
+            (sizeData * 8 * T_MUXSIZE::DmaBitsPerPixelBit * T_MUXSIZE::MuxBusDataSize) / sizeof(uint32_t);
+
+        while (pDma < pEnd)
+        {
+            *(pDma++) &= clearMask;
+        }
+    }
+#endif
+
     void Reset()
     {
         MaxBusDataSize = 0;
         UpdateMap = 0;
         UpdateMapMask = 0;
         BusCount = 0;
+#if defined(NPB_CONF_MUX_TRANSPOSE)
+        for (size_t muxId = 0; muxId < BusMaxCount; muxId++)
+        {
+            BusData[muxId] = nullptr;
+            BusDataSize[muxId] = 0;
+        }
+#endif
+#if defined(NPB_CONF_MUX_INCREMENTAL)
+        for (size_t muxId = 0; muxId < BusMaxCount; muxId++)
+        {
+            free(BusShadow[muxId]);
+            BusShadow[muxId] = nullptr;
+        }
+        EncodedMap = 0;
+        StaleMap = 0;
+#endif
     }
 };
 
@@ -472,6 +617,11 @@ public:
         if (MuxMap.IsAllMuxBusesUpdated())
         {
             MuxMap.ResetMuxBusesUpdated();
+
+#if defined(NPB_CONF_MUX_TRANSPOSE)
+            // the last FillBuffers() waited for the prior write to complete
+            MuxMap.EncodeAllIntoDma(LcdBuffer);
+#endif
             
             gdma_reset(_dmaChannel);
             LCD_CAM.lcd_user.lcd_dout = 1;
@@ -494,7 +644,21 @@ public:
             yield();
         }
 
-
+#if defined(NPB_CONF_MUX_TRANSPOSE)
+        // encoded together with all the other mux buses in StartWrite()
+        MuxMap.SetMuxBusData(muxId, data, sizeData);
+#elif defined(NPB_CONF_MUX_INCREMENTAL)
+        // a mux bus that hasn't changed keeps its bits in the buffer, 
+        // a changed one clears and rewrites only its own bits
+        if (MuxMap.UpdateMuxBusShadow(muxId, data, sizeData))
+        {
+            MuxMap.ClearMuxBusInDma(LcdBuffer, sizeData, muxId);
+            MuxMap.EncodeIntoDma(LcdBuffer,
+                data,
+                sizeData,
+                muxId);
+        }
+#else
         // to keep the inner loops for EncodeIntoDma smaller
         // they will just OR in their values
         // so the buffer must be cleared first
@@ -508,6 +672,7 @@ public:
             data,
             sizeData,
             muxId);
+#endif
 
         MuxMap.MarkMuxBusUpdated(muxId);
     }
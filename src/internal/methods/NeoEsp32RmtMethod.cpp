@@ -31,8 +31,10 @@ License along with NeoPixel.  If not, see
 
 #if defined(ARDUINO_ARCH_ESP32) && !defined(CONFIG_IDF_TARGET_ESP32C6) && !defined(CONFIG_IDF_TARGET_ESP32H2)
 
+#include "../NeoUtil.h"
 #include "../NeoSettings.h"
 #include "../NeoBusChannel.h"
+#include "NeoBits.h"
 #include "NeoEsp32RmtMethod.h"
 
 // translate NeoPixelBuffer into RMT buffer
@@ -63,41 +65,52 @@ void NeoEsp32RmtSpeed::_translate(const void* src,
         return;
     }
 
-    size_t size = 0;
-    size_t num = 0;
+    // bytes that fit in the wanted items, but always at least one
+    // and never more than what remains of the source
+    size_t size = (wanted_num + 7) / 8;
+
+    if (size > src_size)
+    {
+        size = src_size;
+    }
+    if (size == 0)
+    {
+        size = 1;
+    }
+
+    // each pair of source bits as the two rmt items they are sent as,
+    // the most significant bit first so in the lower address
+    const uint64_t rmtPair[4] =
+    {
+        (static_cast<uint64_t>(rmtBit0) << 32) | rmtBit0,
+        (static_cast<uint64_t>(rmtBit1) << 32) | rmtBit0,
+        (static_cast<uint64_t>(rmtBit0) << 32) | rmtBit1,
+        (static_cast<uint64_t>(rmtBit1) << 32) | rmtBit1
+    };
+
     const uint8_t* psrc = static_cast<const uint8_t*>(src);
-    rmt_item32_t* pdest = dest;
+    const uint8_t* psrcEnd = psrc + size;
+    uint64_t* pdest64 = reinterpret_cast<uint64_t*>(dest);
 
-    for (;;)
+    // two stores per nibble, unrolled across the byte
+    while (psrc < psrcEnd)
     {
-        uint8_t data = *psrc;
-
-        for (uint8_t bit = 0; bit < 8; bit++)
-        {
-            pdest->val = (data & 0x80) ? rmtBit1 : rmtBit0;
-            pdest++;
-            data <<= 1;
-        }
-        num += 8;
-        size++;
-
-        // if this is the last byte we need to adjust the length of the last pulse
-        if (size >= src_size)
-        {
-            // extend the last bits LOW value to include the full reset signal length
-            pdest--;
-            pdest->duration1 = rmtDurationReset;
-            // and stop updating data to send
-            break;
-        }
-
-        if (num >= wanted_num)
-        {
-            // stop updating data to send
-            break;
-        }
-
-        psrc++;
+        uint8_t data = *(psrc++);
+
+        *(pdest64++) = rmtPair[data >> 6];
+        *(pdest64++) = rmtPair[(data >> 4) & 0x03];
+        *(pdest64++) = rmtPair[(data >> 2) & 0x03];
+        *(pdest64++) = rmtPair[data & 0x03];
+    }
+
+    size_t num = size * 8;
+
+    // if this is the last byte we need to adjust the length of the last pulse
+    if (size >= src_size)
+    {
+        // extend the last bits LOW value to include the full reset signal length
+        rmt_item32_t* pdest = dest + num - 1;
+        pdest->duration1 = rmtDurationReset;
     }
 
     *translated_size = size;
@@ -373,4 +386,26 @@ void NeoEsp32RmtInvertedSpeedGs1903::Translate(const void* src,
         RmtBit0, RmtBit1, RmtDurationReset);
 }
 
+void NeoEsp32RmtSpeedDmx512::Translate(const void* src,
+    rmt_item32_t* dest,
+    size_t src_size,
+    size_t wanted_num,
+    size_t* translated_size,
+    size_t* item_num)
+{
+    _translate(src, dest, src_size, wanted_num, translated_size, item_num,
+        RmtBit0, RmtBit1, RmtDurationReset);
+}
+
+void NeoEsp32RmtSpeedWs2821::Translate(const void* src,
+    rmt_item32_t* dest,
+    size_t src_size,
+    size_t wanted_num,
+    size_t* translated_size,
+    size_t* item_num)
+{
+    _translate(src, dest, src_size, wanted_num, translated_size, item_num,
+        RmtBit0, RmtBit1, RmtDurationReset);
+}
+
 #endif
\ No newline at end of file
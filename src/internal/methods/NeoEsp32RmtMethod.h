@@ -49,6 +49,8 @@ extern "C"
 #include <driver/rmt.h>
 }
 
+#include "NeoDmx512Encoder.h"
+
 #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(4, 3, 0)
 #define NEOPIXELBUS_RMT_INT_FLAGS (ESP_INTR_FLAG_LOWMED)
 #else
@@ -478,6 +480,78 @@ public:
         size_t* item_num);
 };
 
+// DMX512/WS2821 are sent from a bit stream encoded by NeoDmx512Encoder,
+// so each source bit is one item with the same level for the whole bit 
+// time, split in two halves to fit the item
+class NeoEsp32RmtSpeedDmx512Base : public NeoEsp32RmtSpeed
+{
+public:
+    inline constexpr static uint32_t Item32Level(uint8_t level, uint16_t nsBit)
+    {
+        return ((FromNs(nsBit) - FromNs(nsBit / 2)) << 16) | (static_cast<uint32_t>(level) << 31) | 
+            (static_cast<uint32_t>(level) << 15) | FromNs(nsBit / 2);
+    }
+};
+
+class NeoEsp32RmtSpeedDmx512 : public NeoEsp32RmtSpeedDmx512Base
+{
+public:
+    typedef NeoDmx512Protocol Protocol;
+    typedef NeoDmx512Encoder<NeoBitsNotInverted> Encoder;
+
+    const static rmt_idle_level_t IdleLevel = RMT_IDLE_LEVEL_HIGH;
+
+    const static DRAM_ATTR uint32_t RmtBit0 = Item32Level(0, Protocol::BitSendTimeNs);
+    const static DRAM_ATTR uint32_t RmtBit1 = Item32Level(1, Protocol::BitSendTimeNs);
+    // the stream ends in mark, which the idle level continues
+    const static DRAM_ATTR uint16_t RmtDurationReset = FromNs(Protocol::BitSendTimeNs) - FromNs(Protocol::BitSendTimeNs / 2);
+
+    static void IRAM_ATTR Translate(const void* src,
+        rmt_item32_t* dest,
+        size_t src_size,
+        size_t wanted_num,
+        size_t* translated_size,
+        size_t* item_num);
+};
+
+class NeoEsp32RmtSpeedWs2821 : public NeoEsp32RmtSpeedDmx512Base
+{
+public:
+    typedef NeoWs2821Protocol Protocol;
+    typedef NeoDmx512Encoder<NeoBitsNotInverted> Encoder;
+
+    const static rmt_idle_level_t IdleLevel = RMT_IDLE_LEVEL_HIGH;
+
+    const static DRAM_ATTR uint32_t RmtBit0 = Item32Level(0, Protocol::BitSendTimeNs);
+    const static DRAM_ATTR uint32_t RmtBit1 = Item32Level(1, Protocol::BitSendTimeNs);
+    // the stream ends in mark, which the idle level continues
+    const static DRAM_ATTR uint16_t RmtDurationReset = FromNs(Protocol::BitSendTimeNs) - FromNs(Protocol::BitSendTimeNs / 2);
+
+    static void IRAM_ATTR Translate(const void* src,
+        rmt_item32_t* dest,
+        size_t src_size,
+        size_t wanted_num,
+        size_t* translated_size,
+        size_t* item_num);
+};
+
+// the items are the signal levels, so only the stream and idle are inverted
+class NeoEsp32RmtInvertedSpeedDmx512 : public NeoEsp32RmtSpeedDmx512
+{
+public:
+    typedef NeoDmx512Encoder<NeoBitsInverted> Encoder;
+
+    const static rmt_idle_level_t IdleLevel = RMT_IDLE_LEVEL_LOW;
+};
+
+class NeoEsp32RmtInvertedSpeedWs2821 : public NeoEsp32RmtSpeedWs2821
+{
+public:
+    typedef NeoDmx512Encoder<NeoBitsInverted> Encoder;
+
+    const static rmt_idle_level_t IdleLevel = RMT_IDLE_LEVEL_LOW;
+};
+
 class NeoEsp32RmtChannel0
 {
 public:
@@ -691,6 +765,138 @@ private:
     }
 };
 
+//
+// DMX512/WS2821 over a RMT channel, one universe per channel
+// 
+// T_SPEED - NeoEsp32RmtSpeedDmx512 (ex NeoEsp32RmtSpeedWs2821) used to define output signal form
+// T_CHANNEL - NeoEsp32RmtChannel*, the RMT channel to use
+//
+template<typename T_SPEED, typename T_CHANNEL> class NeoEsp32RmtDmx512MethodBase
+{
+public:
+    typedef NeoNoSettings SettingsObject;
+
+    NeoEsp32RmtDmx512MethodBase(uint8_t pin, uint16_t pixelCount, size_t elementSize, size_t settingsSize) :
+        _sizeData(pixelCount * elementSize + settingsSize + T_SPEED::Protocol::HeaderSize),
+        _sizeStream(T_SPEED::Encoder::template EncodedSize<uint8_t>(_sizeData, T_SPEED::Protocol::BreakMabBits)),
+        _pin(pin)
+    {
+        construct();
+    }
+
+    NeoEsp32RmtDmx512MethodBase(uint8_t pin, uint16_t pixelCount, size_t elementSize, size_t settingsSize, NeoBusChannel channel) :
+        _sizeData(pixelCount * elementSize + settingsSize + T_SPEED::Protocol::HeaderSize),
+        _sizeStream(T_SPEED::Encoder::template EncodedSize<uint8_t>(_sizeData, T_SPEED::Protocol::BreakMabBits)),
+        _pin(pin),
+        _channel(channel)
+    {
+        construct();
+    }
+
+    ~NeoEsp32RmtDmx512MethodBase()
+    {
+        // wait until the last send finishes before destructing everything
+        // arbitrary time out of 10 seconds
+        ESP_ERROR_CHECK_WITHOUT_ABORT(rmt_wait_tx_done(_channel.RmtChannelNumber, 10000 / portTICK_PERIOD_MS));
+
+        ESP_ERROR_CHECK(rmt_driver_uninstall(_channel.RmtChannelNumber));
+
+        gpio_matrix_out(_pin, SIG_GPIO_OUT_IDX, false, false);
+        pinMode(_pin, INPUT);
+
+        free(_data);
+        free(_stream);
+    }
+
+    bool IsReadyToUpdate() const
+    {
+        return (ESP_OK == ESP_ERROR_CHECK_WITHOUT_ABORT_SILENT_TIMEOUT(rmt_wait_tx_done(_channel.RmtChannelNumber, 0)));
+    }
+
+    void Initialize()
+    {
+        rmt_config_t config = {};
+
+        config.rmt_mode = RMT_MODE_TX;
+        config.channel = _channel.RmtChannelNumber;
+        config.gpio_num = static_cast<gpio_num_t>(_pin);
+        config.mem_block_num = 1;
+        config.tx_config.loop_en = false;
+        
+        config.tx_config.idle_output_en = true;
+        config.tx_config.idle_level = T_SPEED::IdleLevel;
+
+        config.tx_config.carrier_en = false;
+        config.tx_config.carrier_level = RMT_CARRIER_LEVEL_LOW;
+
+        config.clk_div = T_SPEED::RmtClockDivider;
+
+        ESP_ERROR_CHECK(rmt_config(&config));
+        ESP_ERROR_CHECK(rmt_driver_install(_channel.RmtChannelNumber, 0, NEOPIXELBUS_RMT_INT_FLAGS));
+        ESP_ERROR_CHECK(rmt_translator_init(_channel.RmtChannelNumber, T_SPEED::Translate));
+    }
+
+    void Update(bool)
+    {
+        // wait for not actively sending data
+        // this will time out at 10 seconds, an arbitrarily long period of time
+        // and do nothing if this happens
+        if (ESP_OK == ESP_ERROR_CHECK_WITHOUT_ABORT(rmt_wait_tx_done(_channel.RmtChannelNumber, 10000 / portTICK_PERIOD_MS)))
+        {
+            // the stream is only read by the async send, so the slots stay editable
+            T_SPEED::Encoder::Encode(_data, _data + _sizeData, 
+                _stream, _stream + _sizeStream, 
+                T_SPEED::Protocol::BreakMabBits);
+
+            ESP_ERROR_CHECK_WITHOUT_ABORT(rmt_write_sample(_channel.RmtChannelNumber, _stream, _sizeStream, false));
+        }
+    }
+
+    bool AlwaysUpdate()
+    {
+        // this method requires update to be called only if changes to buffer
+        return false;
+    }
+
+    bool SwapBuffers()
+    {
+        return false;
+    }
+
+    uint8_t* getData() const
+    {
+        return _data + T_SPEED::Protocol::HeaderSize;
+    };
+
+    size_t getDataSize() const
+    {
+        return _sizeData - T_SPEED::Protocol::HeaderSize;
+    }
+
+    void applySettings([[maybe_unused]] const SettingsObject& settings)
+    {
+    }
+
+private:
+    const size_t  _sizeData;      // Size of '_data' buffer, including the start code
+    const size_t  _sizeStream;    // Size of '_stream' buffer
+    const uint8_t _pin;            // output pin number
+    const T_CHANNEL _channel; // holds instance for multi channel support
+
+    uint8_t*  _data;      // Holds slot values, exposed for get and set
+    uint8_t*  _stream;    // Holds the encoded bit stream used for async send using RMT
+
+    void construct()
+    {
+        _data = static_cast<uint8_t*>(malloc(_sizeData));
+        // first "slot" cleared due to protocol requiring it to be zero
+        memset(_data, 0x00, T_SPEED::Protocol::HeaderSize);
+
+        _stream = static_cast<uint8_t*>(malloc(_sizeStream));
+        // no need to initialize it, it gets overwritten on every send
+    }
+};
+
 // normal
 typedef NeoEsp32RmtMethodBase<NeoEsp32RmtSpeedWs2811, NeoEsp32RmtChannelN> NeoEsp32RmtNWs2811Method;
 typedef NeoEsp32RmtMethodBase<NeoEsp32RmtSpeedWs2812x, NeoEsp32RmtChannelN> NeoEsp32RmtNWs2812xMethod;
@@ -978,6 +1184,12 @@ typedef NeoEsp32Rmt7Ws2805InvertedMethod NeoEsp32Rmt7Ws2814InvertedMethod;
 #endif // !defined(CONFIG_IDF_TARGET_ESP32C3)
 
 
+// DMX512 / WS2821, one universe per channel, with the channel given at construction
+typedef NeoEsp32RmtDmx512MethodBase<NeoEsp32RmtSpeedDmx512, NeoEsp32RmtChannelN> NeoEsp32RmtNDmx512Method;
+typedef NeoEsp32RmtDmx512MethodBase<NeoEsp32RmtSpeedWs2821, NeoEsp32RmtChannelN> NeoEsp32RmtNWs2821Method;
+typedef NeoEsp32RmtDmx512MethodBase<NeoEsp32RmtInvertedSpeedDmx512, NeoEsp32RmtChannelN> NeoEsp32RmtNDmx512InvertedMethod;
+typedef NeoEsp32RmtDmx512MethodBase<NeoEsp32RmtInvertedSpeedWs2821, NeoEsp32RmtChannelN> NeoEsp32RmtNWs2821InvertedMethod;
+
 #if defined(NEOPIXEL_ESP32_RMT_DEFAULT) || defined(CONFIG_IDF_TARGET_ESP32S2) || defined(CONFIG_IDF_TARGET_ESP32C3) || defined(CONFIG_IDF_TARGET_ESP32S3)
 
 // Normally I2s method is the default, defining NEOPIXEL_ESP32_RMT_DEFAULT 
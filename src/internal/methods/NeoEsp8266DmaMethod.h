@@ -80,91 +80,145 @@ template<typename T_PATTERN> class NeoEsp8266Dma3StepEncode : public T_PATTERN
 public:
     const static size_t DmaBitsPerPixelBit = 3; // 3 step cadence, matches encoding
 
+    // NeoChunkedDmaEncoder policy
+    const static size_t DmaBytesPerDataByte = DmaBitsPerPixelBit;
+    const static size_t ChunkDataAlignment = 4; // whole 32 bit dma words
+    const static size_t DmaOverrun = sizeof(uint32_t); // the remaining bits store
+
     static size_t SpacingPixelSize(size_t sizePixel)
     {
         return sizePixel;
     }
 
+    static void EncodeIntoDma(uint8_t* dmaBuffer, const uint8_t* data, size_t sizeData)
+    {
+        FillBuffers(dmaBuffer, data, sizeData, 0);
+    }
+
+    static size_t EncodedDmaSize(size_t sizeData)
+    {
+        // rounded to whole words
+        return ((sizeData * DmaBytesPerDataByte + 3) / 4) * 4;
+    }
+
+    static void FillIdleDma(uint8_t* dmaBuffer, size_t sizeDma)
+    {
+        memset(dmaBuffer, T_PATTERN::IdleLevel * 0xff, sizeDma);
+    }
+
     static void FillBuffers(uint8_t* i2sBuffer,
         const uint8_t* data,
         size_t sizeData,
         [[maybe_unused]] size_t sizePixel)
     {
-        const uint8_t SrcBitMask = 0x80;
-        const size_t BitsInSample = sizeof(uint32_t) * 8;
-
         uint32_t* pDma = reinterpret_cast<uint32_t*>(i2sBuffer);
-        uint32_t dmaValue = 0;
-        uint8_t destBitsLeft = BitsInSample;
-
         const uint8_t* pSrc = data;
         const uint8_t* pEnd = pSrc + sizeData;
+        // four source bytes are 96 bits, exactly three dma words
+        const uint8_t* pEndQuads = pSrc + (sizeData & ~static_cast<size_t>(3));
+
+        while (pSrc < pEndQuads)
+        {
+            uint32_t group0 = Convert3Step(*(pSrc++));
+            uint32_t group1 = Convert3Step(*(pSrc++));
+            uint32_t group2 = Convert3Step(*(pSrc++));
+            uint32_t group3 = Convert3Step(*(pSrc++));
+
+            *(pDma++) = (group0 << 8) | (group1 >> 16);
+            *(pDma++) = (group1 << 16) | (group2 >> 8);
+            *(pDma++) = (group2 << 24) | group3;
+        }
+
+        // store the remaining bits, an empty word when none
+        uint32_t dmaValue = 0;
+        uint8_t destBitsLeft = 32;
 
         while (pSrc < pEnd)
         {
-            uint8_t value = *(pSrc++);
+            uint32_t group = Convert3Step(*(pSrc++));
 
-            for (uint8_t bitSrc = 0; bitSrc < 8; bitSrc++)
+            if (destBitsLeft > 24)
             {
-                const uint16_t Bit = ((value & SrcBitMask) ? T_PATTERN::OneBit3Step : T_PATTERN::ZeroBit3Step);
-
-                if (destBitsLeft > 3)
-                {
-                    destBitsLeft -= 3;
-                    dmaValue |= Bit << destBitsLeft;
+                destBitsLeft -= 24;
+                dmaValue |= group << destBitsLeft;
+            }
+            else
+            {
+                uint8_t bitSplit = 24 - destBitsLeft;
 
-#if defined(NEO_DEBUG_DUMP_I2S_BUFFER)
-                    NeoUtil::PrintBin<uint32_t>(dmaValue);
-                    Serial.print(" < ");
-                    Serial.println(destBitsLeft);
-#endif
-                }
-                else if (destBitsLeft <= 3)
-                {
-                    uint8_t bitSplit = (3 - destBitsLeft);
-                    dmaValue |= Bit >> bitSplit;
+                *(pDma++) = dmaValue | (group >> bitSplit);
+                destBitsLeft = 32 - bitSplit;
+                dmaValue = group << destBitsLeft;
+            }
+        }
+        *(pDma++) = dmaValue;
 
 #if defined(NEO_DEBUG_DUMP_I2S_BUFFER)
-                    NeoUtil::PrintBin<uint32_t>(dmaValue);
-                    Serial.print(" > ");
-                    Serial.println(bitSplit);
+        for (uint32_t* pDump = reinterpret_cast<uint32_t*>(i2sBuffer); pDump < pDma; pDump++)
+        {
+            NeoUtil::PrintBin<uint32_t>(*pDump);
+            Serial.println();
+        }
 #endif
-                    // next dma value, store and reset
-                    *(pDma++) = dmaValue;
-                    dmaValue = 0;
+    }
 
-                    destBitsLeft = BitsInSample - bitSplit;
-                    if (bitSplit)
-                    {
-                        dmaValue |= Bit << destBitsLeft;
-                    }
+protected:
+    // the four 3 step symbols of a nibble, most significant bit first
+    constexpr static uint16_t NibbleSymbols(uint8_t nibble)
+    {
+        return (((nibble & 0x08) ? T_PATTERN::OneBit3Step : T_PATTERN::ZeroBit3Step) << 9) |
+            (((nibble & 0x04) ? T_PATTERN::OneBit3Step : T_PATTERN::ZeroBit3Step) << 6) |
+            (((nibble & 0x02) ? T_PATTERN::OneBit3Step : T_PATTERN::ZeroBit3Step) << 3) |
+            ((nibble & 0x01) ? T_PATTERN::OneBit3Step : T_PATTERN::ZeroBit3Step);
+    }
 
-#if defined(NEO_DEBUG_DUMP_I2S_BUFFER)
-                    NeoUtil::PrintBin<uint32_t>(dmaValue);
-                    Serial.print(" v ");
-                    Serial.println(bitSplit);
-#endif
-                }
+    static const uint16_t _nibbleSymbols[16];
 
-                // Next
-                value <<= 1;
-            }
-        }
-        // store the remaining bits
-        *pDma++ = dmaValue;
+    // the 24 bits of symbols of a byte
+    static uint32_t Convert3Step(uint8_t value)
+    {
+        return (static_cast<uint32_t>(_nibbleSymbols[value >> 4]) << 12) | _nibbleSymbols[value & 0x0f];
     }
 };
 
+template<typename T_PATTERN> const uint16_t NeoEsp8266Dma3StepEncode<T_PATTERN>::_nibbleSymbols[16] =
+{
+    NibbleSymbols(0x0), NibbleSymbols(0x1), NibbleSymbols(0x2), NibbleSymbols(0x3),
+    NibbleSymbols(0x4), NibbleSymbols(0x5), NibbleSymbols(0x6), NibbleSymbols(0x7),
+    NibbleSymbols(0x8), NibbleSymbols(0x9), NibbleSymbols(0xa), NibbleSymbols(0xb),
+    NibbleSymbols(0xc), NibbleSymbols(0xd), NibbleSymbols(0xe), NibbleSymbols(0xf)
+};
+
 template<typename T_PATTERN> class NeoEsp8266Dma4StepEncode : public T_PATTERN
 {
 public:
     const static size_t DmaBitsPerPixelBit = 4; // 4 step cadence, matches encoding
 
+    // NeoChunkedDmaEncoder policy
+    const static size_t DmaBytesPerDataByte = DmaBitsPerPixelBit;
+    const static size_t ChunkDataAlignment = 1;
+    const static size_t DmaOverrun = 0;
+
     static size_t SpacingPixelSize(size_t sizePixel)
     {
         return sizePixel;
     }
 
+    static void EncodeIntoDma(uint8_t* dmaBuffer, const uint8_t* data, size_t sizeData)
+    {
+        FillBuffers(dmaBuffer, data, sizeData, 0);
+    }
+
+    static size_t EncodedDmaSize(size_t sizeData)
+    {
+        return sizeData * DmaBytesPerDataByte;
+    }
+
+    static void FillIdleDma(uint8_t* dmaBuffer, size_t sizeDma)
+    {
+        memset(dmaBuffer, T_PATTERN::IdleLevel * 0xff, sizeDma);
+    }
+
     static void FillBuffers(uint8_t* i2sBuffer,
         const uint8_t* data,
         size_t sizeData,
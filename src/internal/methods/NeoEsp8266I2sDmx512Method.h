@@ -28,6 +28,7 @@ License along with NeoPixel.  If not, see
 
 #ifdef ARDUINO_ARCH_ESP8266
 #include "NeoEsp8266I2sMethodCore.h"
+#include "NeoDmx512Encoder.h"
 
 
 class NeoEsp8266I2sDmx512SpeedBase
@@ -37,8 +38,9 @@ public:
     static const uint32_t I2sClockDivisor = 20; // 0-63
     static const uint32_t I2sBaseClockDivisor = 32; // 0-63
     static const uint32_t ByteSendTimeUs = 44; // us it takes to send a single pixel element of 11 bits
-    static const uint32_t BreakMabUs = 96; // Break min 92, Mab min 12
-    static const size_t BreakMabSize = 4; // roundupby((BreakMabUs/4us)/8,4) count of bytes needed for the Break+Mab timing
+    static const uint32_t BreakMabUs = 128; // Break min 92, Mab min 12, NeoDmx512Protocol::BreakMabBits at 4us
+    static const size_t BreakMabSize = NeoDmx512Protocol::BreakMabBits / 8; // count of bytes needed for the Break+Mab timing
+    static_assert(BreakMabSize % 4 == 0, "Break+Mab must fill whole i2s words");
     static const uint32_t MtbpUs = 11; // Mtbp, min 0, buy we use at least one byte of space (8*1.35)
     static const size_t MtbpSize = 1; // (MtbpUs/1.35)/8 count of bytes needed for the Mtbp timing
     // DMX requires the first slot to be zero
@@ -49,32 +51,14 @@ class NeoEsp8266I2sDmx512Speed : public NeoEsp8266I2sDmx512SpeedBase
 {
 public:
     static const uint8_t MtbpLevel = 0x1; // high
-    static const uint8_t StartBit = 0b00000000; 
-    static const uint8_t StopBits = 0b00000011; 
-    static const uint32_t Break = 0x00000000; // Break
-    static const uint32_t BreakMab = 0x00000007; // Break + Mab
-
-    static uint8_t Convert(uint8_t value)
-    {
-        // DMX requires LSB order
-        return NeoUtil::Reverse8Bits( value );
-    }
+    typedef NeoDmx512Encoder<NeoBitsNotInverted> Encoder;
 };
 
 class NeoEsp8266I2sDmx512InvertedSpeed : public NeoEsp8266I2sDmx512SpeedBase
 {
 public:
     static const uint8_t MtbpLevel = 0x00; // low
-    static const uint8_t StartBit = 0b00000001;
-    static const uint8_t StopBits = 0b00000000;
-    static const uint32_t Break = 0xffffffff; // Break
-    static const uint32_t BreakMab = 0xfffffff8; // Break + Mab
-
-    static uint8_t Convert(uint8_t value)
-    {
-        // DMX requires LSB order
-        return NeoUtil::Reverse8Bits( ~value );
-    }
+    typedef NeoDmx512Encoder<NeoBitsInverted> Encoder;
 };
 
 
@@ -85,8 +69,9 @@ public:
     static const uint32_t I2sClockDivisor = 27; // 0-63
     static const uint32_t I2sBaseClockDivisor = 8; // 0-63
     static const uint32_t ByteSendTimeUs = 15; // us it takes to send a single pixel element of 11 bits
-    static const uint32_t BreakMabUs = 92; // Break min 88, Mab min 4
-    static const size_t BreakMabSize = 12; // roundupby((BreakMabUs/1.35)/8,4) count of bytes needed for the Break+Mab timing
+    static const uint32_t BreakMabUs = 128; // Break min 88, Mab min 4, NeoWs2821Protocol::BreakMabBits at 1.33us
+    static const size_t BreakMabSize = NeoWs2821Protocol::BreakMabBits / 8; // count of bytes needed for the Break+Mab timing
+    static_assert(BreakMabSize % 4 == 0, "Break+Mab must fill whole i2s words");
     static const uint32_t MtbpUs = 88; // Mtbp, min 88
     static const size_t MtbpSize = 9; // (MtbpUs/1.35)/8 count of bytes needed for the Mtbp timing
     
@@ -98,32 +83,14 @@ class NeoEsp8266I2sWs2821Speed : public NeoEsp8266I2sWs2821SpeedBase
 {
 public:
     static const uint8_t MtbpLevel = 0x1; // high
-    static const uint8_t StartBit = 0b00000000;
-    static const uint8_t StopBits = 0b00000011;
-    static const uint32_t Break = 0x00000000; // Break
-    static const uint32_t BreakMab = 0x00000007; // Break + Mab (4~12us/1.35us)
-
-    static uint8_t Convert(uint8_t value)
-    {
-        // DMX requires LSB order
-        return NeoUtil::Reverse8Bits(value);
-    }
+    typedef NeoDmx512Encoder<NeoBitsNotInverted> Encoder;
 };
 
 class NeoEsp8266I2sWs2821InvertedSpeed : public NeoEsp8266I2sWs2821SpeedBase
 {
 public:
     static const uint8_t MtbpLevel = 0x00; // low
-    static const uint8_t StartBit = 0b00000001;
-    static const uint8_t StopBits = 0b00000000;
-    static const uint32_t Break = 0xffffffff; // Break
-    static const uint32_t BreakMab = 0xfffffff8; // Break + Mab
-
-    static uint8_t Convert(uint8_t value)
-    {
-        // DMX requires LSB order
-        return NeoUtil::Reverse8Bits(~value);
-    }
+    typedef NeoDmx512Encoder<NeoBitsInverted> Encoder;
 };
 
 template<typename T_SPEED> class NeoEsp8266I2sDmx512MethodBase : NeoEsp8266I2sMethodCore
@@ -239,103 +206,15 @@ private:
     const size_t  _sizeData;    // Size of '_data' buffer 
     uint8_t*  _data;        // Holds LED color values
 
-    // encodes the data with start and stop bits
-    // input buffer is bytes
-    // output stream is uint31_t
-    static void Encoder(const uint8_t* pSrc, const uint8_t* pSrcEnd, 
-            uint32_t* pOutput, const uint32_t* pOutputEnd)
-    {
-        static const uint32_t Mtbp = 0xffffffff * T_SPEED::MtbpLevel;
-        const uint8_t* pData = pSrc;
-
-        int8_t outputBit = 32;
-        uint32_t output = 0;
-
-        // DATA stream, one start, two stop
-        while (pData < pSrcEnd)
-        {
-            uint8_t data = T_SPEED::Convert( *(pData++) );
-
-            if (outputBit > 10)
-            {
-                // simple
-                outputBit -= 1;
-                output |= T_SPEED::StartBit << outputBit;
-
-                outputBit -= 8;
-                output |= data << outputBit;
-
-                outputBit -= 2;
-                output |= T_SPEED::StopBits << outputBit;
-            }
-            else
-            {
-                // split across an output uint32_t
-                // handle start bit
-                if (outputBit < 1)
-                {
-                    *(pOutput++) = output;
-                    output = 0;
-                    outputBit += 32;
-                }
-                outputBit -= 1;
-                output |= (T_SPEED::StartBit << outputBit);
-
-                // handle data bits
-                if (outputBit < 8)
-                {
-                    output |= data >> (8 - outputBit);
-
-                    *(pOutput++) = output;
-                    output = 0;
-                    outputBit += 32;
-                }
-                outputBit -= 8;
-                output |= data << outputBit;
-
-                // handle stop bits
-                if (outputBit < 2)
-                {
-                    output |= T_SPEED::StopBits >> (2 - outputBit);
-
-                    *(pOutput++) = output;
-                    output = 0;
-                    outputBit += 32;
-                }
-                outputBit -= 2;
-                output |= T_SPEED::StopBits << outputBit;
-            }
-        }
-        if (outputBit > 0)
-        {
-            // padd last output uint32_t with Mtbp
-            output |= Mtbp >> (32 - outputBit);
-            *(pOutput++) = output;
-        }
-        // fill the rest of the output with Mtbp
-        while (pOutput < pOutputEnd)
-        {
-            *(pOutput++) = Mtbp;
-        }
-    }
-
-
     void FillBuffers()
     {
         uint32_t* pDma32 = reinterpret_cast<uint32_t*>(_i2sBuffer);
         const uint32_t* pDma32End = reinterpret_cast<uint32_t*>(_i2sBuffer + _i2sBufferSize);
 
-        // first insert Break space as needed
-        for (size_t count = 1; 
-            count < (T_SPEED::BreakMabSize/sizeof(T_SPEED::Break));
-            count++)
-        {
-            *(pDma32++) = T_SPEED::Break;
-        }
-        // then tail of break with mab
-        *(pDma32++) = T_SPEED::BreakMab;
-        
-        Encoder(_data, _data + _sizeData, pDma32, pDma32End);
+        // Break+Mab, the slots with start and stop bits, then Mtbp 
+        T_SPEED::Encoder::Encode(_data, _data + _sizeData, 
+            pDma32, pDma32End, 
+            T_SPEED::BreakMabSize * 8);
     }
 
     uint32_t getPixelTime() const
@@ -0,0 +1,135 @@
+/*-------------------------------------------------------------------------
+NeoMuxTranspose provides bit matrix transposing for parallel mux bus encoding.
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+// ------------------------------------------------------------------------
+// NeoMuxTranspose turns the bytes of up to 8 (or 16) parallel mux buses 
+// into bit planes, where each bit plane holds the same bit from every 
+// bus, one bus per bit; which is the layout a parallel DMA sample needs.
+// This allows all buses to be encoded in one pass that writes each DMA 
+// sample once rather than each bus reading and OR'ing into all of them.
+// ------------------------------------------------------------------------
+class NeoMuxTranspose
+{
+public:
+    // ------------------------------------------------------------------------
+    // Transpose8x8 
+    // lanes - 8 bytes, one from each bus
+    // planes - 8 bytes, where bit n of planes[k] is bit (7 - k) of lanes[n],
+    //      so planes[0] holds the most significant bits, the first sent
+    // ------------------------------------------------------------------------
+    static void Transpose8x8(const uint8_t* lanes, uint8_t* planes)
+    {
+        // Hacker's Delight transpose8, rows loaded in reverse so 
+        // that lane n lands in bit n of the result
+        uint32_t x = (static_cast<uint32_t>(lanes[7]) << 24) |
+            (static_cast<uint32_t>(lanes[6]) << 16) |
+            (static_cast<uint32_t>(lanes[5]) << 8) |
+            lanes[4];
+        uint32_t y = (static_cast<uint32_t>(lanes[3]) << 24) |
+            (static_cast<uint32_t>(lanes[2]) << 16) |
+            (static_cast<uint32_t>(lanes[1]) << 8) |
+            lanes[0];
+        uint32_t t;
+
+        t = (x ^ (x >> 7)) & 0x00aa00aa;
+        x = x ^ t ^ (t << 7);
+        t = (y ^ (y >> 7)) & 0x00aa00aa;
+        y = y ^ t ^ (t << 7);
+
+        t = (x ^ (x >> 14)) & 0x0000cccc;
+        x = x ^ t ^ (t << 14);
+        t = (y ^ (y >> 14)) & 0x0000cccc;
+        y = y ^ t ^ (t << 14);
+
+        t = (x & 0xf0f0f0f0) | ((y >> 4) & 0x0f0f0f0f);
+        y = ((x << 4) & 0xf0f0f0f0) | (y & 0x0f0f0f0f);
+        x = t;
+
+        planes[0] = x >> 24;
+        planes[1] = x >> 16;
+        planes[2] = x >> 8;
+        planes[3] = x;
+        planes[4] = y >> 24;
+        planes[5] = y >> 16;
+        planes[6] = y >> 8;
+        planes[7] = y;
+    }
+
+    // ------------------------------------------------------------------------
+    // Gather8 collects the byte at index from 8 buses and transposes them
+    // planes - 8 bit planes as Transpose8x8
+    // busData - 8 bus data pointers
+    // busDataSize - 8 bus data sizes, zero for unused buses
+    // index - the byte index within each bus data
+    // returns - the mask of buses that have data at index
+    // ------------------------------------------------------------------------
+    static uint8_t Gather8(uint8_t* planes, 
+        const uint8_t* const* busData, 
+        const size_t* busDataSize, 
+        size_t index)
+    {
+        uint8_t lanes[8];
+        uint8_t present = 0;
+
+        for (uint8_t lane = 0; lane < 8; lane++)
+        {
+            if (index < busDataSize[lane])
+            {
+                lanes[lane] = busData[lane][index];
+                present |= (1 << lane);
+            }
+            else
+            {
+                lanes[lane] = 0;
+            }
+        }
+
+        Transpose8x8(lanes, planes);
+        return present;
+    }
+
+    // ------------------------------------------------------------------------
+    // Gather16 is Gather8 for 16 buses, with 16 bit planes
+    // ------------------------------------------------------------------------
+    static uint16_t Gather16(uint16_t* planes, 
+        const uint8_t* const* busData, 
+        const size_t* busDataSize, 
+        size_t index)
+    {
+        uint8_t low[8];
+        uint8_t high[8];
+        uint16_t present = Gather8(low, busData, busDataSize, index) |
+            (static_cast<uint16_t>(Gather8(high, busData + 8, busDataSize + 8, index)) << 8);
+
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            planes[bit] = low[bit] | (static_cast<uint16_t>(high[bit]) << 8);
+        }
+        return present;
+    }
+};
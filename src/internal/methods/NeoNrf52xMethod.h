@@ -31,8 +31,31 @@ License along with NeoPixel.  If not, see
 
 #if defined(ARDUINO_ARCH_NRF52840)
 
+#include "NeoChunkedDmaEncoder.h"
+#include "NeoNrf52xPwmEncoder.h"
+
 const uint16_t c_dmaBytesPerDataByte = 8 * sizeof(nrf_pwm_values_common_t); // bits * bytes to represent pulse
 
+// NPB_CONF_NRF52X_STREAMING streams the data through two small chunks 
+// rather than a DMA buffer 16 times the size of the pixel data, 
+// at the cost of Show() not returning until the last chunks are queued.
+// Each chunk is refilled while the other is sent, so the refill has one
+// chunk time (NPB_CONF_NRF52X_STREAM_CHUNK * 8 bit times, 10us per byte 
+// at 800Kbps) to complete.  Any interrupt longer than that, like 
+// SoftDevice radio events, makes the PWM replay a stale chunk and the 
+// strip shows corrupt data.  This underrun is detected, the output is 
+// stopped and held for the reset time, and the frame is sent again, up 
+// to NPB_CONF_NRF52X_STREAM_RETRIES times.
+// Size NPB_CONF_NRF52X_STREAM_CHUNK so that one chunk time is longer than 
+// the longest interrupt of the sketch, like 128 (1.28ms at 800Kbps) with
+// BLE active; each data byte of a chunk costs 32 bytes of DMA memory.
+#if defined(NPB_CONF_NRF52X_STREAMING) && !defined(NPB_CONF_NRF52X_STREAM_CHUNK)
+#define NPB_CONF_NRF52X_STREAM_CHUNK 16 // data bytes per chunk, 160us at 800Kbps
+#endif
+#if defined(NPB_CONF_NRF52X_STREAMING) && !defined(NPB_CONF_NRF52X_STREAM_RETRIES)
+#define NPB_CONF_NRF52X_STREAM_RETRIES 2 // frame retries after an underrun
+#endif
+
 // for Bit* variables
 // count 1 = 0.0625us, so max count (32768) is 2048us
 
@@ -358,6 +381,10 @@ template<typename T_SPEED, typename T_BUS> class NeoNrf52xMethodBase
 {
 public:
     typedef NeoNoSettings SettingsObject;
+    typedef NeoNrf52xPwmEncoder<T_SPEED> Encoder;
+#if defined(NPB_CONF_NRF52X_STREAMING)
+    typedef NeoChunkedDmaEncoder<Encoder, NPB_CONF_NRF52X_STREAM_CHUNK> StreamEncoder;
+#endif
 
     NeoNrf52xMethodBase(uint8_t pin, uint16_t pixelCount, size_t elementSize, size_t settingsSize) :
         _sizeData(pixelCount * elementSize + settingsSize),
@@ -402,7 +429,12 @@ public:
 
         // must force a first update so the EVENTS_SEQEND gets set as
         // you can't set it manually
+#if defined(NPB_CONF_NRF52X_STREAMING)
+        Encoder::FillReset(_dmaBuffer, _dmaBuffer + (_dmaBufferSize / sizeof(nrf_pwm_values_common_t)));
+        _bus.Pwm()->LOOP = 1;
+#else
         FillBuffer();
+#endif
         dmaStart();
     }
 
@@ -419,8 +451,12 @@ public:
             yield(); // allows for system yield if needed
         }
 
+#if defined(NPB_CONF_NRF52X_STREAMING)
+        StreamBuffer();
+#else
         FillBuffer();
         dmaStart();
+#endif
     }
 
     bool AlwaysUpdate()
@@ -456,6 +492,9 @@ private:
     uint8_t* _data;        // Holds LED color values
     size_t   _dmaBufferSize; // total size of _dmaBuffer
     nrf_pwm_values_common_t* _dmaBuffer;     // Holds pixel data in native format for PWM hardware
+#if defined(NPB_CONF_NRF52X_STREAMING)
+    StreamEncoder _stream; // the two chunks of _dmaBuffer, one per sequence
+#endif
 
     void construct()
     {
@@ -464,8 +503,16 @@ private:
         _data = static_cast<uint8_t*>(malloc(_sizeData));
         // data cleared later in Begin()
 
+#if defined(NPB_CONF_NRF52X_STREAMING)
+        // two chunks, one being sent while the other is refilled
+        _dmaBufferSize = StreamEncoder::DmaBufferSize;
+#else
         _dmaBufferSize = c_dmaBytesPerDataByte * _sizeData + sizeof(nrf_pwm_values_common_t);
+#endif
         _dmaBuffer = static_cast<nrf_pwm_values_common_t*>(malloc(_dmaBufferSize));
+#if defined(NPB_CONF_NRF52X_STREAMING)
+        _stream.Attach(reinterpret_cast<uint8_t*>(_dmaBuffer));
+#endif
     }
 
     void dmaInit()
@@ -483,6 +530,21 @@ private:
         _bus.Pwm()->LOOP = 1; // single fire so events get set
         _bus.Pwm()->DECODER = NRF_PWM_LOAD_COMMON;
 
+#if defined(NPB_CONF_NRF52X_STREAMING)
+        const size_t chunkValues = StreamEncoder::ChunkDmaSize / sizeof(nrf_pwm_values_common_t);
+
+        // the two sequences are the two chunks, played one after the other 
+        // for as many loops as needed, the reset is streamed as BitReset values
+        _bus.Pwm()->SEQ[0].PTR = reinterpret_cast<uint32_t>(_stream.Slot(0));
+        _bus.Pwm()->SEQ[0].CNT = chunkValues;
+        _bus.Pwm()->SEQ[0].REFRESH = 0;
+        _bus.Pwm()->SEQ[0].ENDDELAY = 0;
+
+        _bus.Pwm()->SEQ[1].PTR = reinterpret_cast<uint32_t>(_stream.Slot(1));
+        _bus.Pwm()->SEQ[1].CNT = chunkValues;
+        _bus.Pwm()->SEQ[1].REFRESH = 0;
+        _bus.Pwm()->SEQ[1].ENDDELAY = 0;
+#else
         // sequence zero is the primary data with a BitReset entry on the end for
         // the delay repeating
         _bus.Pwm()->SEQ[0].PTR = reinterpret_cast<uint32_t>(_dmaBuffer);
@@ -495,6 +557,7 @@ private:
         _bus.Pwm()->SEQ[1].CNT = 1;
         _bus.Pwm()->SEQ[1].REFRESH = 0; // ignored
         _bus.Pwm()->SEQ[1].ENDDELAY = 0; // ignored
+#endif
 
         // stop when the loop finishes
         _bus.Pwm()->SHORTS = PWM_SHORTS_LOOPSDONE_STOP_Msk;
@@ -511,28 +574,76 @@ private:
 
     void FillBuffer()
     {
-        nrf_pwm_values_common_t* pDma = _dmaBuffer;
         nrf_pwm_values_common_t* pDmaEnd = _dmaBuffer + (_dmaBufferSize / sizeof(nrf_pwm_values_common_t));
-        uint8_t* pEnd = _data + _sizeData;
+        nrf_pwm_values_common_t* pDma = Encoder::FillBuffer(_dmaBuffer, _data, _sizeData);
+
+        // fill the rest with BitReset as it will get repeated when delaying or
+        // at the end before being stopped
+        Encoder::FillReset(pDma, pDmaEnd);
+    }
 
-        for (uint8_t* pData = _data; pData < pEnd; pData++)
+#if defined(NPB_CONF_NRF52X_STREAMING)
+    void StreamBuffer()
+    {
+        uint8_t retries = 0;
+
+        while (!StreamFrame() && retries < NPB_CONF_NRF52X_STREAM_RETRIES)
         {
-            uint8_t data = *pData;
+            retries++;
+        }
+    }
 
-            for (uint8_t bit = 0; bit < 8; bit++)
+    // returns - false if a chunk was not refilled in time, 
+    //      the output is stopped and the reset time has been held
+    bool StreamFrame()
+    {
+        // both chunks are filled before starting, each loop plays 
+        // both so an odd count of chunks ends with an idle chunk
+        size_t countChunks = _stream.Start(_data, 
+            _sizeData, 
+            T_SPEED::CountReset * sizeof(nrf_pwm_values_common_t));
+        size_t countLoops = (countChunks + 1) / 2;
+
+        _bus.Pwm()->LOOP = countLoops;
+
+        dmaStart();
+
+        // refill each chunk once its sequence has ended, 
+        // while the other sequence is being sent
+        for (size_t chunk = StreamEncoder::SlotCount; chunk < countLoops * 2; chunk++)
+        {
+            uint8_t seq = _stream.NextSlot();
+
+            while (!_bus.Pwm()->EVENTS_SEQEND[seq])
+            {
+            }
+            _bus.Pwm()->EVENTS_SEQEND[seq] = 0;
+
+            _stream.ChunkSent();
+
+            // if the other sequence has already ended, the PWM has 
+            // started this one again before or while it was refilled
+            if (_bus.Pwm()->EVENTS_SEQEND[seq ^ 1])
             {
-                *(pDma++) = (data & 0x80) ? T_SPEED::Bit1 : T_SPEED::Bit0;
-                data <<= 1;
+                dmaStop();
+                return false;
             }
         }
+        return true;
+    }
 
-        // fill the rest with BitReset as it will get repeated when delaying or
-        // at the end before being stopped
-        while (pDma < pDmaEnd)
+    void dmaStop()
+    {
+        _bus.Pwm()->TASKS_STOP = 1;
+        while (!IsReadyToUpdate())
         {
-            *(pDma++) = T_SPEED::BitReset;
         }
+
+        // the pin is back to the idle level, hold it for the reset time 
+        // so the retried frame starts at the first pixel
+        delayMicroseconds((T_SPEED::CountReset * T_SPEED::CountTop + 15) / 16);
     }
+#endif
 
     void dmaResetEvents()
     {
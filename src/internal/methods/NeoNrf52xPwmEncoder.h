@@ -0,0 +1,118 @@
+/*-------------------------------------------------------------------------
+NeoNrf52xPwmEncoder provides the expansion of pixel data into PWM values
+for the Nrf52 methods.
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+
+#pragma once
+
+// ------------------------------------------------------------------------
+// NeoNrf52xPwmEncoder expands each bit of the data into one PWM value,
+// T_SPEED::Bit0 or T_SPEED::Bit1, using a table of the four values for 
+// each nibble so that every nibble is a single 64 bit store.
+// It also fills fixed sized chunks of the stream of the data followed by
+// the reset, so a long strip can be sent through a small DMA window.
+// 
+// T_SPEED - NeoNrf52xPwmSpeed* (ex NeoNrf52xPwmSpeedWs2812x)
+// ------------------------------------------------------------------------
+template<typename T_SPEED> class NeoNrf52xPwmEncoder
+{
+public:
+    const static size_t ValuesPerDataByte = 8; // one pwm value per bit
+
+    // ------------------------------------------------------------------------
+    // FillBuffer expands the data into pwm values
+    // pDma - where to place the values, sizeData * ValuesPerDataByte of them
+    // returns - the position following the last value placed
+    // ------------------------------------------------------------------------
+    static uint16_t* FillBuffer(uint16_t* pDma, const uint8_t* data, size_t sizeData)
+    {
+        uint64_t* pDma64 = reinterpret_cast<uint64_t*>(pDma);
+        const uint8_t* pEnd = data + sizeData;
+
+        while (data < pEnd)
+        {
+            uint8_t value = *(data++);
+
+            *(pDma64++) = _nibbleValues[value >> 4];
+            *(pDma64++) = _nibbleValues[value & 0x0f];
+        }
+
+        return reinterpret_cast<uint16_t*>(pDma64);
+    }
+
+    // ------------------------------------------------------------------------
+    // FillReset fills the rest of a buffer with BitReset
+    // ------------------------------------------------------------------------
+    static void FillReset(uint16_t* pDma, const uint16_t* pDmaEnd)
+    {
+        while (pDma < pDmaEnd)
+        {
+            *(pDma++) = T_SPEED::BitReset;
+        }
+    }
+
+    // NeoChunkedDmaEncoder policy
+    const static size_t DmaBytesPerDataByte = ValuesPerDataByte * sizeof(uint16_t);
+    const static size_t ChunkDataAlignment = 1;
+    const static size_t DmaOverrun = 0;
+
+    static void EncodeIntoDma(uint8_t* dmaBuffer, const uint8_t* data, size_t sizeData)
+    {
+        FillBuffer(reinterpret_cast<uint16_t*>(dmaBuffer), data, sizeData);
+    }
+
+    static size_t EncodedDmaSize(size_t sizeData)
+    {
+        return sizeData * DmaBytesPerDataByte;
+    }
+
+    static void FillIdleDma(uint8_t* dmaBuffer, size_t sizeDma)
+    {
+        uint16_t* pDma = reinterpret_cast<uint16_t*>(dmaBuffer);
+
+        FillReset(pDma, pDma + sizeDma / sizeof(uint16_t));
+    }
+
+protected:
+    // the four values of a nibble, most significant bit first 
+    // and so in the lowest address
+    constexpr static uint64_t NibbleValues(uint8_t nibble)
+    {
+        return static_cast<uint64_t>((nibble & 0x08) ? T_SPEED::Bit1 : T_SPEED::Bit0) |
+            (static_cast<uint64_t>((nibble & 0x04) ? T_SPEED::Bit1 : T_SPEED::Bit0) << 16) |
+            (static_cast<uint64_t>((nibble & 0x02) ? T_SPEED::Bit1 : T_SPEED::Bit0) << 32) |
+            (static_cast<uint64_t>((nibble & 0x01) ? T_SPEED::Bit1 : T_SPEED::Bit0) << 48);
+    }
+
+    static const uint64_t _nibbleValues[16];
+};
+
+template<typename T_SPEED> const uint64_t NeoNrf52xPwmEncoder<T_SPEED>::_nibbleValues[16] =
+{
+    NibbleValues(0x0), NibbleValues(0x1), NibbleValues(0x2), NibbleValues(0x3),
+    NibbleValues(0x4), NibbleValues(0x5), NibbleValues(0x6), NibbleValues(0x7),
+    NibbleValues(0x8), NibbleValues(0x9), NibbleValues(0xa), NibbleValues(0xb),
+    NibbleValues(0xc), NibbleValues(0xd), NibbleValues(0xe), NibbleValues(0xf)
+};
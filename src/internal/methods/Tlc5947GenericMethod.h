@@ -36,6 +36,10 @@ License along with NeoPixel.  If not, see
 
 #define TLC5947_MODULE_PWM_CHANNEL_COUNT 24
 
+// NPB_CONF_TLC5947_CHAIN_BUFFER converts all the cascaded modules into one 
+// buffer and sends it in a single transfer, rather than converting and 
+// sending one module at a time, at the cost of a send buffer for every module
+
 class Tlc5947Converter8Bit
 {
 public:
@@ -66,8 +70,8 @@ public:
         // Write 2 channels into 3 bytes using upper 12-bit of each channel 
         for (int indexChannel = 0; indexChannel < TLC5947_MODULE_PWM_CHANNEL_COUNT; indexChannel += 2)
         {
-            uint8_t ch1 = *channelPtr--;
-            uint8_t ch2 = *channelPtr--;
+            uint16_t ch1 = *channelPtr--;
+            uint16_t ch2 = *channelPtr--;
 
             *sendBufferPtr++ = ch1 >> 8;
             *sendBufferPtr++ = (ch1 & 0xf0) | (ch2 >> 12);
@@ -86,13 +90,16 @@ public:
     static const size_t sizeSendBuffer = 36;
 
     Tlc5947MethodBase(uint8_t pinClock, uint8_t pinData, uint8_t pinLatch, uint8_t pinOutputEnable, uint16_t pixelCount, size_t elementSize, size_t settingsSize) :
-        _countModule((pixelCount * elementSize + TLC5947_MODULE_PWM_CHANNEL_COUNT - 1) / TLC5947_MODULE_PWM_CHANNEL_COUNT),
-        _sizeData(_countModule * TLC5947_MODULE_PWM_CHANNEL_COUNT + settingsSize),
+        _countModule((pixelCount * elementSize / T_BITCONVERT::sizeChannel + TLC5947_MODULE_PWM_CHANNEL_COUNT - 1) / TLC5947_MODULE_PWM_CHANNEL_COUNT),
+        _sizeData(_countModule * TLC5947_MODULE_PWM_CHANNEL_COUNT * T_BITCONVERT::sizeChannel + settingsSize),
         _wire(pinClock, pinData),
         _pinLatch(pinLatch),
         _pinOutputEnable(pinOutputEnable)
     {
         _data = static_cast<uint8_t*>(malloc(_sizeData));
+#if defined(NPB_CONF_TLC5947_CHAIN_BUFFER)
+        _sendBuffer = static_cast<uint8_t*>(malloc(sizeSendBuffer * _countModule));
+#endif
         pinMode(pinLatch, OUTPUT);
         pinMode(pinOutputEnable, OUTPUT);
         digitalWrite(pinOutputEnable, HIGH);
@@ -118,6 +125,9 @@ public:
     ~Tlc5947MethodBase()
     {
         free(_data);
+#if defined(NPB_CONF_TLC5947_CHAIN_BUFFER)
+        free(_sendBuffer);
+#endif
         pinMode(_pinLatch, INPUT);
         pinMode(_pinOutputEnable, INPUT);
     }
@@ -150,6 +160,18 @@ public:
 
         // We need to write the channels in reverse order. Get a Pointer to the last channel.
         uint8_t* lastChannelPtr = _data + ((_countModule * TLC5947_MODULE_PWM_CHANNEL_COUNT - 1) * T_BITCONVERT::sizeChannel);
+#if defined(NPB_CONF_TLC5947_CHAIN_BUFFER)
+        uint8_t* sendBufferPtr = _sendBuffer;
+        for (uint16_t countSend = 0; countSend < _countModule; countSend++)
+        {
+            // We pass a pointer to the last channel and ConvertFrame reads the channels backwards
+            T_BITCONVERT::ConvertFrame(sendBufferPtr, lastChannelPtr);
+            sendBufferPtr += sizeSendBuffer;
+            lastChannelPtr -= TLC5947_MODULE_PWM_CHANNEL_COUNT * T_BITCONVERT::sizeChannel;
+        }
+        // the whole chain in one transfer
+        _wire.transmitBytes(_sendBuffer, sizeSendBuffer * _countModule);
+#else
         for (uint16_t countSend = 0; countSend < _countModule; countSend++)
         {
             // We pass a pointer to the last channel and ConvertFrame reads the channels backwards
@@ -157,6 +179,7 @@ public:
             _wire.transmitBytes(_sendBuffer, sizeSendBuffer);
             lastChannelPtr -= TLC5947_MODULE_PWM_CHANNEL_COUNT * T_BITCONVERT::sizeChannel;
         }        
+#endif
       
         _wire.endTransaction();
         digitalWrite(_pinLatch, HIGH);
@@ -196,7 +219,11 @@ private:
 
     T_TWOWIRE _wire;
     uint8_t*  _data;                        // Holds LED color values
+#if defined(NPB_CONF_TLC5947_CHAIN_BUFFER)
+    uint8_t*  _sendBuffer;                  // Holds channel values for all modules
+#else
     uint8_t   _sendBuffer[sizeSendBuffer];  // Holds channel values for one module
+#endif
     uint8_t   _pinLatch;
     uint8_t   _pinOutputEnable;
 };
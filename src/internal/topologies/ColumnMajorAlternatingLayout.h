@@ -50,19 +50,10 @@ public:
 class ColumnMajorAlternatingLayout : public ColumnMajorAlternatingTilePreference
 {
 public:
-    static uint16_t Map(uint16_t /* width */, uint16_t height, uint16_t x, uint16_t y)
+    static constexpr uint16_t Map(uint16_t /* width */, uint16_t height, uint16_t x, uint16_t y)
     {
-        uint16_t index = x * height;
-
-        if (x & 0x0001)
-        {
-            index += ((height - 1) - y);
-        }
-        else
-        {
-            index += y;
-        }
-        return index;
+        return x * height +
+            ((x & 0x0001) ? ((height - 1) - y) : y);
     }
 };
 
@@ -75,19 +66,10 @@ public:
 class ColumnMajorAlternating90Layout : public ColumnMajorAlternatingTilePreference
 {
 public:
-    static uint16_t Map(uint16_t width, uint16_t /* height */, uint16_t x, uint16_t y)
+    static constexpr uint16_t Map(uint16_t width, uint16_t /* height */, uint16_t x, uint16_t y)
     {
-        uint16_t index = y * width;
-
-        if (y & 0x0001)
-        {
-            index += x;
-        }
-        else
-        {
-            index += ((width - 1) - x);
-        }
-        return index;
+        return y * width +
+            ((y & 0x0001) ? x : ((width - 1) - x));
     }
 };
 
@@ -100,20 +82,10 @@ public:
 class ColumnMajorAlternating180Layout : public ColumnMajorAlternatingTilePreference
 {
 public:
-    static uint16_t Map(uint16_t width, uint16_t height, uint16_t x, uint16_t y)
+    static constexpr uint16_t Map(uint16_t width, uint16_t height, uint16_t x, uint16_t y)
     {
-        uint16_t mx = ((width - 1) - x);
-        uint16_t index = mx * height;
-
-        if (mx & 0x0001)
-        {
-            index += y;
-        }
-        else
-        {
-            index += ((height - 1) - y);
-        }
-        return index;
+        return ((width - 1) - x) * height +
+            ((((width - 1) - x) & 0x0001) ? y : ((height - 1) - y));
     }
 };
 
@@ -126,19 +98,9 @@ public:
 class ColumnMajorAlternating270Layout : public ColumnMajorAlternatingTilePreference
 {
 public:
-    static uint16_t Map(uint16_t width, uint16_t height, uint16_t x, uint16_t y)
+    static constexpr uint16_t Map(uint16_t width, uint16_t height, uint16_t x, uint16_t y)
     {
-        uint16_t my = ((height - 1) - y);
-        uint16_t index = my * width;
-
-        if (my & 0x0001)
-        {
-            index += ((width - 1) - x);
-        }
-        else
-        {
-            index += x;
-        }
-        return index;
+        return ((height - 1) - y) * width +
+            ((((height - 1) - y) & 0x0001) ? ((width - 1) - x) : x);
     }
 };
@@ -52,7 +52,7 @@ public:
 class ColumnMajorLayout : public ColumnMajorTilePreference
 {
 public:
-    static uint16_t Map(uint16_t /* width */, uint16_t height, uint16_t x, uint16_t y)
+    static constexpr uint16_t Map(uint16_t /* width */, uint16_t height, uint16_t x, uint16_t y)
     {
         return x * height + y;
     }
@@ -67,7 +67,7 @@ public:
 class ColumnMajor90Layout : public ColumnMajorTilePreference
 {
 public:
-    static uint16_t Map(uint16_t width, uint16_t /* height */, uint16_t x, uint16_t y)
+    static constexpr uint16_t Map(uint16_t width, uint16_t /* height */, uint16_t x, uint16_t y)
     {
         return (width - 1 - x) + y * width;
     }
@@ -82,7 +82,7 @@ public:
 class ColumnMajor180Layout : public ColumnMajorTilePreference
 {
 public:
-    static uint16_t Map(uint16_t width, uint16_t height, uint16_t x, uint16_t y)
+    static constexpr uint16_t Map(uint16_t width, uint16_t height, uint16_t x, uint16_t y)
     {
         return (width - 1 - x) * height + (height - 1 - y);
     }
@@ -97,7 +97,7 @@ public:
 class ColumnMajor270Layout : public ColumnMajorTilePreference
 {
 public:
-    static uint16_t Map(uint16_t width, uint16_t height, uint16_t x, uint16_t y)
+    static constexpr uint16_t Map(uint16_t width, uint16_t height, uint16_t x, uint16_t y)
     {
         return x + (height - 1 - y) * width;
     }
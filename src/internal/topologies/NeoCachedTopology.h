@@ -0,0 +1,134 @@
+/*-------------------------------------------------------------------------
+NeoCachedTopology provides a lookup table cache of another topology's mapping
+of a 2d cordinate to linear 1d cordinate
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+//-----------------------------------------------------------------------------
+// class NeoCachedTopology
+// Wraps another topology and precomputes its full mapping into a RAM table
+// at construction, so that Map and MapProbe become a bounds check and a
+// single table load.  Useful for NeoTiles and NeoMosaic where each Map call
+// otherwise runs divisions, modulos and layout logic.
+// Costs width * height * 2 bytes of RAM.  When the dimensions are known at
+// compile time, NeoFixedTopology, NeoFixedTiles and NeoFixedMosaic provide
+// the same table in PROGMEM instead through MapLookup.
+// T_TOPOLOGY = the topology to cache, for example
+//      NeoTopology<RowMajorAlternatingLayout>
+//      NeoTiles<RowMajorAlternatingLayout, RowMajorLayout>
+//      NeoMosaic<RowMajorAlternatingLayout>
+//
+// NeoCachedTopology<NeoMosaic<RowMajorAlternatingLayout>> mosaic(8, 8, 8, 4);
+//-----------------------------------------------------------------------------
+template <typename T_TOPOLOGY> class NeoCachedTopology : public T_TOPOLOGY
+{
+public:
+    template <typename... T_ARGS> NeoCachedTopology(T_ARGS... args) :
+        T_TOPOLOGY(args...),
+        _width(T_TOPOLOGY::getWidth()),
+        _height(T_TOPOLOGY::getHeight())
+    {
+        _table = static_cast<uint16_t*>(malloc(_width * _height * sizeof(uint16_t)));
+        if (_table)
+        {
+            uint16_t* pEntry = _table;
+
+            for (uint16_t y = 0; y < _height; y++)
+            {
+                for (uint16_t x = 0; x < _width; x++)
+                {
+                    *pEntry++ = T_TOPOLOGY::MapProbe(x, y);
+                }
+            }
+        }
+    }
+
+    ~NeoCachedTopology()
+    {
+        free(_table);
+    }
+
+    NeoCachedTopology(const NeoCachedTopology&) = delete;
+    NeoCachedTopology& operator=(const NeoCachedTopology&) = delete;
+
+    uint16_t Map(int16_t x, int16_t y) const
+    {
+        if (x >= static_cast<int16_t>(_width))
+        {
+            x = _width - 1;
+        }
+        else if (x < 0)
+        {
+            x = 0;
+        }
+
+        if (y >= static_cast<int16_t>(_height))
+        {
+            y = _height - 1;
+        }
+        else if (y < 0)
+        {
+            y = 0;
+        }
+
+        if (_table == nullptr)
+        {
+            // allocation failed, fall back to calculating
+            return T_TOPOLOGY::Map(x, y);
+        }
+        return _table[y * _width + x];
+    }
+
+    uint16_t MapProbe(int16_t x, int16_t y) const
+    {
+        if (x < 0 || x >= static_cast<int16_t>(_width) ||
+                y < 0 || y >= static_cast<int16_t>(_height))
+        {
+            return _width * _height; // count, out of bounds
+        }
+
+        if (_table == nullptr)
+        {
+            // allocation failed, fall back to calculating
+            return T_TOPOLOGY::MapProbe(x, y);
+        }
+        return _table[y * _width + x];
+    }
+
+    uint16_t getWidth() const
+    {
+        return _width;
+    }
+
+    uint16_t getHeight() const
+    {
+        return _height;
+    }
+
+private:
+    const uint16_t _width;
+    const uint16_t _height;
+    uint16_t* _table;
+};
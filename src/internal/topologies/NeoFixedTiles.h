@@ -0,0 +1,128 @@
+/*-------------------------------------------------------------------------
+NeoFixedTiles provides a compile time mapping feature of a 2d cordinate to
+linear 1d cordinate for tiles of matrices with fixed dimensions
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+//-----------------------------------------------------------------------------
+// class NeoFixedTiles
+// Same as NeoTiles but with the panel and tile dimensions fixed at compile
+// time. Map, MapProbe and TopologyHint are constexpr, and the full mapping
+// is also available as a table in PROGMEM (no RAM) through MapLookup.
+//
+// T_MATRIX_LAYOUT = the layout used on the pixel matrix panel (a tile)
+// T_TILE_LAYOUT = the layout used for the tiles.
+//      one of the following classes and their rotated variants
+//      RowMajorLayout
+//      ColumnMajorLayout
+//      RowMajorAlternatingLayout
+//      ColumnMajorAlternatingLayout
+// V_TOPO_WIDTH, V_TOPO_HEIGHT - the dimensions of a matrix panel
+// V_TILES_WIDTH, V_TILES_HEIGHT - the count of panels across and down
+//
+// NeoFixedTiles<RowMajorAlternatingLayout, RowMajorLayout, 8, 8, 8, 4> tiles;
+//-----------------------------------------------------------------------------
+template <typename T_MATRIX_LAYOUT, 
+    typename T_TILE_LAYOUT,
+    uint16_t V_TOPO_WIDTH,
+    uint16_t V_TOPO_HEIGHT,
+    uint16_t V_TILES_WIDTH,
+    uint16_t V_TILES_HEIGHT> class NeoFixedTiles
+{
+public:
+    static constexpr uint16_t Width = V_TOPO_WIDTH * V_TILES_WIDTH;
+    static constexpr uint16_t Height = V_TOPO_HEIGHT * V_TILES_HEIGHT;
+    static constexpr uint16_t Count = Width * Height;
+
+    typedef NeoFixedTopologyTable<NeoFixedTiles,
+        typename NeoFixedTopologyMakeIndices<Count>::Type> TableType;
+
+    static constexpr uint16_t Map(int16_t x, int16_t y)
+    {
+        return tileOffset(clamp(x, Width), clamp(y, Height)) + 
+            localIndex(clamp(x, Width), clamp(y, Height));
+    }
+
+    static constexpr uint16_t MapProbe(int16_t x, int16_t y)
+    {
+        return (x < 0 || x >= static_cast<int16_t>(Width) ||
+                y < 0 || y >= static_cast<int16_t>(Height)) ?
+            Count : // count, out of bounds
+            tileOffset(x, y) + localIndex(x, y);
+    }
+
+    // same result as Map, but read from the PROGMEM table
+    static uint16_t MapLookup(int16_t x, int16_t y)
+    {
+        return pgm_read_word(TableType::Table +
+            clamp(y, Height) * Width +
+            clamp(x, Width));
+    }
+
+    static constexpr NeoTopologyHint TopologyHint(int16_t x, int16_t y)
+    {
+        return (x < 0 || x >= static_cast<int16_t>(Width) ||
+                y < 0 || y >= static_cast<int16_t>(Height)) ?
+            NeoTopologyHint_OutOfBounds :
+            (localIndex(x, y) == 0) ?
+                NeoTopologyHint_FirstOnPanel :
+                (localIndex(x, y) == (V_TOPO_WIDTH * V_TOPO_HEIGHT - 1)) ?
+                    NeoTopologyHint_LastOnPanel :
+                    NeoTopologyHint_InPanel;
+    }
+
+    static constexpr uint16_t getWidth()
+    {
+        return Width;
+    }
+
+    static constexpr uint16_t getHeight()
+    {
+        return Height;
+    }
+
+private:
+    static constexpr uint16_t clamp(int16_t value, uint16_t size)
+    {
+        return (value < 0) ? 0 :
+            ((value >= static_cast<int16_t>(size)) ? size - 1 : value);
+    }
+
+    static constexpr uint16_t tileOffset(uint16_t x, uint16_t y)
+    {
+        return T_TILE_LAYOUT::Map(V_TILES_WIDTH, 
+            V_TILES_HEIGHT, 
+            x / V_TOPO_WIDTH, 
+            y / V_TOPO_HEIGHT) * (V_TOPO_WIDTH * V_TOPO_HEIGHT);
+    }
+
+    static constexpr uint16_t localIndex(uint16_t x, uint16_t y)
+    {
+        return T_MATRIX_LAYOUT::Map(V_TOPO_WIDTH, 
+            V_TOPO_HEIGHT, 
+            x % V_TOPO_WIDTH, 
+            y % V_TOPO_HEIGHT);
+    }
+};
@@ -0,0 +1,145 @@
+/*-------------------------------------------------------------------------
+NeoFixedTopology provides a compile time mapping feature of a 2d cordinate to
+linear 1d cordinate for matrices with fixed dimensions
+
+Written by Michael C. Miller.
+
+I invest time and resources providing this open source code,
+please support me by donating (see https://github.com/Makuna/NeoPixelBus)
+
+-------------------------------------------------------------------------
+This file is part of the Makuna/NeoPixelBus library.
+
+NeoPixelBus is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+NeoPixelBus is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with NeoPixel.  If not, see
+<http://www.gnu.org/licenses/>.
+-------------------------------------------------------------------------*/
+#pragma once
+
+// compile time sequence of indices 0..N-1, built with logarithmic recursion
+// depth so that large matrices do not exceed the template instantiation limit
+//
+template <uint16_t... V_INDICES> struct NeoFixedTopologyIndices
+{
+};
+
+template <typename T_FIRST, typename T_SECOND> struct NeoFixedTopologyIndicesJoin;
+
+template <uint16_t... V_FIRST, uint16_t... V_SECOND>
+struct NeoFixedTopologyIndicesJoin<NeoFixedTopologyIndices<V_FIRST...>, NeoFixedTopologyIndices<V_SECOND...>>
+{
+    typedef NeoFixedTopologyIndices<V_FIRST..., (sizeof...(V_FIRST) + V_SECOND)...> Type;
+};
+
+template <uint16_t V_COUNT> struct NeoFixedTopologyMakeIndices
+{
+    typedef typename NeoFixedTopologyIndicesJoin<
+        typename NeoFixedTopologyMakeIndices<V_COUNT / 2>::Type,
+        typename NeoFixedTopologyMakeIndices<V_COUNT - V_COUNT / 2>::Type>::Type Type;
+};
+
+template <> struct NeoFixedTopologyMakeIndices<0>
+{
+    typedef NeoFixedTopologyIndices<> Type;
+};
+
+template <> struct NeoFixedTopologyMakeIndices<1>
+{
+    typedef NeoFixedTopologyIndices<0> Type;
+};
+
+// the full mapping table of a fixed topology (NeoFixedTopology, 
+// NeoFixedTiles, NeoFixedMosaic), computed by the compiler from its 
+// constexpr Map and stored in PROGMEM
+//
+template <typename T_FIXED_TOPOLOGY, typename T_INDICES>
+class NeoFixedTopologyTable;
+
+template <typename T_FIXED_TOPOLOGY, uint16_t... V_INDICES>
+class NeoFixedTopologyTable<T_FIXED_TOPOLOGY, NeoFixedTopologyIndices<V_INDICES...>>
+{
+public:
+    static const uint16_t Table[sizeof...(V_INDICES)];
+};
+
+template <typename T_FIXED_TOPOLOGY, uint16_t... V_INDICES>
+const uint16_t NeoFixedTopologyTable<T_FIXED_TOPOLOGY, NeoFixedTopologyIndices<V_INDICES...>>::Table[sizeof...(V_INDICES)] PROGMEM =
+{
+    T_FIXED_TOPOLOGY::Map(V_INDICES % T_FIXED_TOPOLOGY::Width, V_INDICES / T_FIXED_TOPOLOGY::Width)...
+};
+
+//-----------------------------------------------------------------------------
+// class NeoFixedTopology
+// Same as NeoTopology but with the width and height fixed at compile time.
+// Map and MapProbe are constexpr, so constant coordinates fold away and
+// variable coordinates compile to arithmetic against constant dimensions.
+// The full mapping is also available as a table in PROGMEM (no RAM), either
+// directly through Table or through MapLookup.
+//
+// T_LAYOUT - the following classes and their rotated variants
+//      RowMajorLayout
+//      ColumnMajorLayout
+//      RowMajorAlternatingLayout
+//      ColumnMajorAlternatingLayout
+// V_WIDTH, V_HEIGHT - the dimensions of the matrix
+//
+// NeoFixedTopology<RowMajorAlternatingLayout, 16, 16> topo;
+//-----------------------------------------------------------------------------
+template <typename T_LAYOUT, uint16_t V_WIDTH, uint16_t V_HEIGHT> class NeoFixedTopology
+{
+public:
+    static constexpr uint16_t Width = V_WIDTH;
+    static constexpr uint16_t Height = V_HEIGHT;
+    static constexpr uint16_t Count = V_WIDTH * V_HEIGHT;
+
+    typedef NeoFixedTopologyTable<NeoFixedTopology,
+        typename NeoFixedTopologyMakeIndices<Count>::Type> TableType;
+
+    static constexpr uint16_t Map(int16_t x, int16_t y)
+    {
+        return T_LAYOUT::Map(V_WIDTH, V_HEIGHT, clamp(x, V_WIDTH), clamp(y, V_HEIGHT));
+    }
+
+    static constexpr uint16_t MapProbe(int16_t x, int16_t y)
+    {
+        return (x < 0 || x >= static_cast<int16_t>(V_WIDTH) ||
+                y < 0 || y >= static_cast<int16_t>(V_HEIGHT)) ?
+            Count : // count, out of bounds
+            T_LAYOUT::Map(V_WIDTH, V_HEIGHT, x, y);
+    }
+
+    // same result as Map, but read from the PROGMEM table
+    static uint16_t MapLookup(int16_t x, int16_t y)
+    {
+        return pgm_read_word(TableType::Table +
+            clamp(y, V_HEIGHT) * V_WIDTH +
+            clamp(x, V_WIDTH));
+    }
+
+    static constexpr uint16_t getWidth()
+    {
+        return V_WIDTH;
+    }
+
+    static constexpr uint16_t getHeight()
+    {
+        return V_HEIGHT;
+    }
+
+private:
+    static constexpr uint16_t clamp(int16_t value, uint16_t size)
+    {
+        return (value < 0) ? 0 :
+            ((value >= static_cast<int16_t>(size)) ? size - 1 : value);
+    }
+};
@@ -51,7 +51,7 @@ public:
 class RowMajorLayout : public RowMajorTilePreference
 {
 public:
-    static uint16_t Map(uint16_t width, uint16_t /* height */, uint16_t x, uint16_t y)
+    static constexpr uint16_t Map(uint16_t width, uint16_t /* height */, uint16_t x, uint16_t y)
     {
         return x + y * width;
     }
@@ -66,7 +66,7 @@ public:
 class RowMajor90Layout : public RowMajorTilePreference
 {
 public:
-    static uint16_t Map(uint16_t width, uint16_t height, uint16_t x, uint16_t y)
+    static constexpr uint16_t Map(uint16_t width, uint16_t height, uint16_t x, uint16_t y)
     {
         return (width - 1 - x) * height + y;
     }
@@ -81,7 +81,7 @@ public:
 class RowMajor180Layout : public RowMajorTilePreference
 {
 public:
-    static uint16_t Map(uint16_t width, uint16_t height, uint16_t x, uint16_t y)
+    static constexpr uint16_t Map(uint16_t width, uint16_t height, uint16_t x, uint16_t y)
     {
         return (width - 1 - x) + (height - 1 - y) * width;
     }
@@ -96,7 +96,7 @@ public:
 class RowMajor270Layout : public RowMajorTilePreference
 {
 public:
-    static uint16_t Map(uint16_t /* width */, uint16_t height, uint16_t x, uint16_t y)
+    static constexpr uint16_t Map(uint16_t /* width */, uint16_t height, uint16_t x, uint16_t y)
     {
         return x * height + (height - 1 - y);
     }